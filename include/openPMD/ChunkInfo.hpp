@@ -29,7 +29,10 @@
 #endif
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace openPMD
@@ -69,6 +72,13 @@ struct ChunkInfo
 struct WrittenChunkInfo : ChunkInfo
 {
     unsigned int sourceID = 0; //!< ID of the data source containing the chunk
+    /**
+     * Lower and upper bound of the values contained in the chunk, if known.
+     * Reported by backends that keep per-chunk statistics and used by
+     * BaseRecordComponent::availableChunks(filter). Not considered in
+     * comparisons.
+     */
+    std::optional<std::pair<double, double>> valueBounds;
 
     explicit WrittenChunkInfo() = default;
     /*
@@ -84,7 +94,256 @@ using ChunkTable = std::vector<WrittenChunkInfo>;
 
 namespace chunk_assignment
 {
+    /**
+     * Meta information on the participating ranks of a data producer or
+     * consumer, e.g. their hostnames as returned by Series::rankTable() or
+     * host_info::byMethodCollective().
+     */
     using RankMeta = std::map<unsigned int, std::string>;
+
+    /**
+     * Chunks assigned to each reading rank.
+     */
+    using Assignment = std::map<unsigned int, std::vector<WrittenChunkInfo>>;
+
+    /**
+     * Intermediate result of a chunk distribution: Some chunks are already
+     * assigned to reading ranks, others are still left to be assigned.
+     */
+    struct PartialAssignment
+    {
+        ChunkTable notAssigned;
+        Assignment assigned;
+
+        explicit PartialAssignment() = default;
+        PartialAssignment(ChunkTable notAssigned);
+        PartialAssignment(ChunkTable notAssigned, Assignment assigned);
+    };
+
+    /**
+     * @brief Interface for a chunk distribution strategy.
+     *
+     * Assigns all chunks of a dataset to the ranks of a data consumer.
+     * Each reading rank runs the same strategy on the same input, yielding
+     * the same assignment on each of them without further communication.
+     */
+    struct Strategy
+    {
+        /**
+         * @param table Chunks to assign, e.g. from
+         *        BaseRecordComponent::availableChunks().
+         * @param rankMetaIn Meta information on the writing ranks, indexed
+         *        by WrittenChunkInfo::sourceID, e.g. from Series::rankTable().
+         * @param rankMetaOut Meta information on the reading ranks. Chunks
+         *        are assigned to these ranks only.
+         */
+        Assignment assign(
+            ChunkTable table,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut);
+
+        /**
+         * Assign the chunks that remain in partialAssignment.notAssigned,
+         * keeping the already assigned ones.
+         */
+        virtual Assignment assign(
+            PartialAssignment partialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) = 0;
+
+        virtual std::unique_ptr<Strategy> clone() const = 0;
+
+        virtual ~Strategy() = default;
+    };
+
+    /**
+     * @brief Interface for a chunk distribution strategy that may leave
+     *        some chunks unassigned.
+     *
+     * Use FromPartialStrategy to combine with a Strategy that assigns the
+     * remaining chunks.
+     */
+    struct PartialStrategy
+    {
+        PartialAssignment assign(
+            ChunkTable table,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut);
+
+        virtual PartialAssignment assign(
+            PartialAssignment partialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) = 0;
+
+        virtual std::unique_ptr<PartialStrategy> clone() const = 0;
+
+        virtual ~PartialStrategy() = default;
+    };
+
+    /**
+     * @brief Run a PartialStrategy first, then assign the remaining chunks
+     *        with a (fallback) Strategy.
+     */
+    struct FromPartialStrategy : Strategy
+    {
+        FromPartialStrategy(
+            std::unique_ptr<PartialStrategy> firstPass,
+            std::unique_ptr<Strategy> secondPass);
+
+        Assignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) override;
+
+        std::unique_ptr<Strategy> clone() const override;
+
+    private:
+        std::unique_ptr<PartialStrategy> m_firstPass;
+        std::unique_ptr<Strategy> m_secondPass;
+    };
+
+    /**
+     * @brief Simple strategy that assigns produced chunks to reading ranks
+     *        in a round-robin manner.
+     *
+     * Chunks are not split, so the load is only balanced if the chunks are
+     * of similar size.
+     */
+    struct RoundRobin : Strategy
+    {
+        Assignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) override;
+
+        std::unique_ptr<Strategy> clone() const override;
+    };
+
+    /**
+     * @brief Strategy that assigns chunks to reading ranks on the same host
+     *        as the writing rank that produced them.
+     *
+     * Hosts are identified by comparing the strings in rankMetaIn and
+     * rankMetaOut. Within each host, the chunks are distributed with the
+     * given strategy among the reading ranks of that host.
+     * Chunks produced on hosts without any reading rank remain unassigned.
+     */
+    struct ByHostname : PartialStrategy
+    {
+        ByHostname(std::unique_ptr<Strategy> withinNode);
+
+        PartialAssignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) override;
+
+        std::unique_ptr<PartialStrategy> clone() const override;
+
+    private:
+        std::unique_ptr<Strategy> m_withinNode;
+    };
+
+    /**
+     * @brief Strategy that balances the amount of data per reading rank.
+     *
+     * The reading ranks are filled one after another with chunks, largest
+     * first, up to the ideal amount of data per rank. A chunk that does not
+     * fit into the current rank is split along the dimension
+     * splitAlongDimension, the rest goes to the next rank.
+     * Chunk sizes are measured in elements, which is proportional to bytes
+     * within one dataset.
+     */
+    struct BinPacking : Strategy
+    {
+        size_t splitAlongDimension = 0;
+
+        /**
+         * @param splitAlongDimension If a chunk needs to be split, split it
+         *        along this dimension.
+         */
+        BinPacking(size_t splitAlongDimension = 0);
+
+        Assignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) override;
+
+        std::unique_ptr<Strategy> clone() const override;
+    };
+
+    /**
+     * @brief Describes how to cut a dataset into one block per reading rank.
+     */
+    struct BlockSlicer
+    {
+        /**
+         * @return The offset and extent of the block for rank out of size
+         *         ranks in a dataset of the given total extent.
+         */
+        virtual std::pair<Offset, Extent>
+        sliceBlock(Extent const &totalExtent, size_t size, size_t rank) = 0;
+
+        virtual std::unique_ptr<BlockSlicer> clone() const = 0;
+
+        virtual ~BlockSlicer() = default;
+    };
+
+    /**
+     * @brief Cut the dataset into slabs of (nearly) equal thickness along
+     *        one dimension.
+     */
+    struct OneDimensionalBlockSlicer : BlockSlicer
+    {
+        Extent::value_type m_dim = 0;
+
+        OneDimensionalBlockSlicer(Extent::value_type dim = 0);
+
+        std::pair<Offset, Extent> sliceBlock(
+            Extent const &totalExtent, size_t size, size_t rank) override;
+
+        std::unique_ptr<BlockSlicer> clone() const override;
+    };
+
+    /**
+     * @brief Strategy that assigns each reading rank one block of the
+     *        dataset, as given by a BlockSlicer, and thereby the
+     *        intersections of all chunks with that block.
+     *
+     * Chunks are cut at block boundaries. Each rank reads a contiguous
+     * hyperslab of the dataset.
+     */
+    struct ByCuboidSlice : Strategy
+    {
+        ByCuboidSlice(
+            std::unique_ptr<BlockSlicer> blockSlicer, Extent totalExtent);
+
+        Assignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) override;
+
+        std::unique_ptr<Strategy> clone() const override;
+
+    private:
+        std::unique_ptr<BlockSlicer> m_blockSlicer;
+        Extent m_totalExtent;
+    };
+
+    /**
+     * @brief Strategy that throws if any chunks remain to be assigned.
+     *
+     * Use as second pass of FromPartialStrategy to enforce that the first
+     * pass covers all chunks.
+     */
+    struct FailingStrategy : Strategy
+    {
+        Assignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) override;
+
+        std::unique_ptr<Strategy> clone() const override;
+    };
 } // namespace chunk_assignment
 
 namespace host_info
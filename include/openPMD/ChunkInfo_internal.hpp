@@ -65,3 +65,16 @@ std::string posix_hostname();
 std::string mpi_processor_name();
 #endif
 } // namespace openPMD::host_info
+
+namespace openPMD::chunk_assignment
+{
+/**
+ * @brief Merge chunks that are adjacent along one dimension and coincide in
+ *        all other dimensions (and in their sourceID) into larger chunks.
+ *
+ * Useful for backends that report chunks at the granularity of their
+ * storage layout, which may be much finer than the written regions.
+ * The resulting table is sorted by offset.
+ */
+void mergeChunks(ChunkTable &);
+} // namespace openPMD::chunk_assignment
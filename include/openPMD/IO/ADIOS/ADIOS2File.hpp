@@ -35,6 +35,8 @@
 
 #include <functional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace openPMD
 {
@@ -229,6 +231,21 @@ public:
 
     using AttributeMap_t = std::map<std::string, adios2::Params>;
 
+    /*
+     * Contents of one level in the hierarchy of attribute or variable names,
+     * as given by splitting the names at '/'.
+     */
+    struct HierarchyLevel
+    {
+        // names of the attributes/variables located directly at this level
+        std::vector<std::string> leaves;
+        // names of the sublevels containing further attributes/variables
+        std::vector<std::string> sublevels;
+    };
+    // keys are the levels' prefixes including a trailing slash, e.g.
+    // "/data/100/meshes/", the level "" contains names without slashes
+    using HierarchyIndex_t = std::unordered_map<std::string, HierarchyLevel>;
+
     ADIOS2File(ADIOS2IOHandlerImpl &impl, InvalidatableFile file);
 
     ~ADIOS2File();
@@ -325,6 +342,13 @@ public:
     std::vector<std::string>
     availableAttributesPrefixed(std::string const &prefix);
 
+    /*
+     * Attributes directly at the given prefix, answered from an index
+     * that is built once per (re)population of the attribute map.
+     * A missing trailing slash is added to the prefix.
+     */
+    HierarchyLevel const &attributesAt(std::string const &prefix);
+
     /*
      * See description below.
      */
@@ -335,6 +359,11 @@ public:
     std::vector<std::string>
     availableVariablesPrefixed(std::string const &prefix);
 
+    /*
+     * Analogous to attributesAt().
+     */
+    HierarchyLevel const &variablesAt(std::string const &prefix);
+
     /*
      * See description below.
      */
@@ -435,6 +464,14 @@ private:
     std::optional<AttributeMap_t> m_availableAttributes;
     std::optional<AttributeMap_t> m_availableVariables;
 
+    /*
+     * Hierarchical indexes over the above maps for listing paths, datasets
+     * and attributes without scanning all names below a prefix.
+     * Invalidated along with the maps.
+     */
+    std::optional<HierarchyIndex_t> m_attributesIndex;
+    std::optional<HierarchyIndex_t> m_variablesIndex;
+
     std::set<Writable *> m_pathsMarkedAsActive;
 
     /*
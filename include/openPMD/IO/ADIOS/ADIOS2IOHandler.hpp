@@ -188,6 +188,15 @@ public:
     void
     getBufferView(Writable *, Parameter<Operation::GET_BUFFER_VIEW> &) override;
 
+    void readBufferView(
+        Writable *, Parameter<Operation::READ_BUFFER_VIEW> &) override;
+
+    /*
+     * Whether the configured engine hands out pointers into its own memory
+     * for reading, see readBufferView().
+     */
+    bool supportsReadBufferView() const;
+
     void readAttribute(Writable *, Parameter<Operation::READ_ATT> &) override;
 
     void listPaths(Writable *, Parameter<Operation::LIST_PATHS> &) override;
@@ -851,5 +860,7 @@ public:
     }
 
     std::future<void> flush(internal::ParsedFlushParams &) override;
+
+    bool supportsReadBufferView() const override;
 }; // ADIOS2IOHandler
 } // namespace openPMD
@@ -30,12 +30,17 @@
 #include <mpi.h>
 #endif
 
+#include <cstdint>
 #include <future>
+#include <map>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace openPMD
 {
@@ -75,6 +80,26 @@ enum class FlushLevel
     CreateOrOpenFiles
 };
 
+namespace internal
+{
+    struct PreparedFlushConfig;
+} // namespace internal
+
+/**
+ * @brief Backend configuration for Series::flush(), parsed ahead of time.
+ *
+ * Create via Series::prepareFlushConfig() and pass to Series::flush() as
+ * often as needed. Parsing happens once when creating the object, unused
+ * keys are reported only upon the first flush using it.
+ */
+class FlushConfig
+{
+    friend class Series;
+
+private:
+    std::shared_ptr<internal::PreparedFlushConfig const> m_prepared;
+};
+
 namespace internal
 {
     /**
@@ -86,6 +111,10 @@ namespace internal
     {
         FlushLevel flushLevel = FlushLevel::InternalFlush;
         std::string backendConfig = "{}";
+        /*
+         * If set, used instead of parsing backendConfig.
+         */
+        std::shared_ptr<PreparedFlushConfig const> preparedBackendConfig;
 
         explicit FlushParams()
         {}
@@ -104,6 +133,80 @@ namespace internal
 
     struct ParsedFlushParams;
 
+    /*
+     * Background thread executing the IO queue for the asynchronous flush
+     * mode, defined in AbstractIOHandler.cpp.
+     */
+    class AsyncFlushWorker;
+
+    /*
+     * Results of metadata reads (listing paths, datasets and attributes,
+     * reading attributes) below the Iterations of a read-only file-based
+     * Series, persisted in its metadata index (see Series.cpp).
+     * Objects are identified by their keys in the openPMD hierarchy below
+     * their Iteration, e.g. "meshes/E/x", so the cache is independent of
+     * the backend.
+     * The AbstractIOHandler serves enqueued reads from it if possible and
+     * records the results of those that reach the backend.
+     */
+    struct MetadataCache
+    {
+        struct Object
+        {
+            std::optional<std::vector<std::string>> attributeNames;
+            std::optional<std::vector<std::string>> paths;
+            std::optional<std::vector<std::string>> datasets;
+            std::map<std::string, std::pair<Datatype, Attribute::resource>>
+                attributes;
+        };
+
+        struct CachedIteration
+        {
+            enum class State
+            {
+                // loaded from the index, the file has not been checked yet
+                Unchecked,
+                // loaded from the index, the file is unchanged
+                Valid,
+                // filled from backend results in this session
+                Recording
+            };
+            State state = State::Recording;
+            // file name within the directory, size and modification time
+            // when the hierarchy was recorded
+            std::string filename;
+            std::uint64_t size = 0;
+            std::int64_t modificationTime = 0;
+            // by path below the Iteration
+            std::map<std::string, Object> objects;
+        };
+
+        std::string directory;
+        // by iteration index
+        std::map<std::string, CachedIteration> iterations;
+        // results have been recorded that are not yet part of the index
+        bool changed = false;
+
+        /*
+         * Fill the output parameters of a LIST_PATHS, LIST_DATASETS,
+         * LIST_ATTS or READ_ATT task from the cache.
+         * Return false if the task must be executed by the backend.
+         */
+        bool serve(IOTask const &);
+        // record the outcome of a task executed by the backend
+        void record(IOTask const &);
+        // attributes of these types do not survive the index
+        static bool isCacheable(Datatype);
+
+    private:
+        /*
+         * Iteration index and path below the Iteration of an object in a
+         * file-based Series, e.g. {"100", "meshes/E/x"}.
+         */
+        static std::optional<std::pair<std::string, std::string>>
+        locateInIteration(Writable const *);
+    };
+
     /**
      * Some parts of the openPMD object model are read-only when accessing
      * a Series in Access::READ_ONLY mode, notably Containers and Attributes.
@@ -246,10 +349,20 @@ public:
      */
     virtual void enqueue(IOTask const &iotask)
     {
+        awaitPendingFlush();
+        if (m_metadataCache && m_metadataCache->serve(iotask))
+        {
+            return;
+        }
         m_work.push(iotask);
     }
 
     /** Process operations in queue according to FIFO.
+     *
+     * If asynchronous flushing has been enabled via enableAsyncFlush(),
+     * user-level flushes that contain only output operations are executed on
+     * a background thread. Any other access to the IO queue will wait for
+     * such a flush to complete first.
      *
      * @return  Future indicating the completion state of the operation for
      * backends that decide to implement this operation asynchronously.
@@ -266,6 +379,37 @@ public:
     /** The currently used backend */
     virtual std::string backendName() const = 0;
 
+    /** Whether the backend may serve Operation::READ_BUFFER_VIEW from its own
+     * memory at all, given its configuration.
+     *
+     * If not, the frontend skips that task and reads into a user buffer right
+     * away, without flushing the queue for it.
+     */
+    virtual bool supportsReadBufferView() const
+    {
+        return false;
+    }
+
+    /** Execute user-level flushes on a dedicated IO thread.
+     *
+     * Opt-in via the JSON/TOML key `async.threads` in the Series
+     * configuration. Only queues that do not contain operations with output
+     * parameters (reading, listing, step control) are dispatched to the
+     * background thread, the rest is still processed synchronously.
+     * Buffers passed to storeChunk() must stay valid and unmodified until
+     * the background flush has completed, i.e. until the next interaction
+     * with the IO handler.
+     */
+    void enableAsyncFlush();
+
+    /** Wait for a flush running on the background thread to finish.
+     *
+     * Rethrows any error that occurred in the background flush. No-op if
+     * there is no such flush. Must be called before destroying the concrete
+     * IO handler if asynchronous flushing is enabled.
+     */
+    void awaitPendingFlush();
+
     std::string directory;
     /*
      * Originally, the reason for distinguishing these two was that during
@@ -286,6 +430,10 @@ public:
     Access m_frontendAccess;
     internal::SeriesStatus m_seriesStatus = internal::SeriesStatus::Default;
     std::queue<IOTask> m_work;
+    /*
+     * Set by file-based read-only Series using their metadata index.
+     */
+    std::shared_ptr<internal::MetadataCache> m_metadataCache;
     /**
      * This is to avoid that the destructor tries flushing again if an error
      * happened. Otherwise, this would lead to confusing error messages.
@@ -294,6 +442,15 @@ public:
      * The destructor will only attempt flushing again if this is true.
      */
     bool m_lastFlushSuccessful = false;
+
+private:
+    /*
+     * Shared instead of unique since IO handlers are copy-assigned during
+     * deferred Series initialization. The worker is only enabled after that.
+     */
+    std::shared_ptr<internal::AsyncFlushWorker> m_asyncFlushWorker;
+
+    bool canFlushAsynchronously(internal::FlushParams const &) const;
 }; // AbstractIOHandler
 
 } // namespace openPMD
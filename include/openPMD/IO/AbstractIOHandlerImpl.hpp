@@ -312,6 +312,31 @@ public:
         // default implementation: operation unsupported by backend
         parameters.out->backendManagedBuffer = false;
     }
+    /** Expose the contents of an existing dataset from memory owned by the
+     * backend, without copying them into a user buffer.
+     *
+     * The region to expose is given by parameters.offset and
+     * parameters.extent, its datatype by parameters.dtype. If the backend can
+     * serve this region from a contiguous, row-major buffer of its own, it
+     * should set parameters.out->ptr to that buffer and
+     * parameters.out->backendManagedBuffer = true. The buffer must stay valid
+     * and unmodified at least until the next Operation::ADVANCE task where
+     * parameters.mode == AdvanceMode::ENDSTEP or until the file is closed.
+     *
+     * This IOTask is optional and should either (1) not be implemented by a
+     * backend at all or (2) be implemented as indicated above. Backends that
+     * cannot serve a specific request should set
+     * parameters.out->backendManagedBuffer = false, the frontend will then
+     * fall back to Operation::READ_DATASET.
+     * The frontend only enqueues this task if
+     * AbstractIOHandler::supportsReadBufferView() returns true.
+     */
+    virtual void readBufferView(
+        Writable *, Parameter<Operation::READ_BUFFER_VIEW> &parameters)
+    {
+        // default implementation: operation unsupported by backend
+        parameters.out->backendManagedBuffer = false;
+    }
     /** Create a single attribute and fill the value, possibly overwriting an
      * existing attribute.
      *
@@ -405,6 +430,16 @@ public:
     virtual void
     setWritten(Writable *, Parameter<Operation::SET_WRITTEN> const &param);
 
+    /** Prepare the listed files for being opened and read subsequently.
+     *
+     * This is an optimization hint only, backends may e.g. read and parse
+     * the files concurrently using up to parameters.threads threads.
+     * Errors should not be reported here, but by the subsequent OPEN_FILE.
+     * The default implementation does nothing.
+     */
+    virtual void prefetchFiles(
+        Writable *, Parameter<Operation::PREFETCH_FILES> const &parameters);
+
     AbstractIOHandler *m_handler;
     bool m_verboseIOTasks = false;
 
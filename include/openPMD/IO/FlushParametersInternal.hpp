@@ -26,14 +26,35 @@
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+
 namespace openPMD::internal
 {
+/*
+ * Shared state behind openPMD::FlushConfig.
+ */
+struct PreparedFlushConfig
+{
+    PreparedFlushConfig(json::ParsedConfig);
+
+    json::ParsedConfig parsed;
+    /*
+     * Set by the first flush using this config, which reports unused keys.
+     */
+    mutable std::atomic<bool> reportedUnusedOptions{false};
+};
+
 struct ParsedFlushParams
 {
     ParsedFlushParams(FlushParams const &);
 
     FlushLevel flushLevel = FlushLevel::InternalFlush;
     json::TracingJSON backendConfig;
+    /*
+     * False if the same prepared config has already been checked for unused
+     * keys in an earlier flush.
+     */
+    bool reportUnusedOptions = true;
 };
 
 ParsedFlushParams const defaultParsedFlushParams{defaultFlushParams};
@@ -44,6 +44,8 @@ public:
 
     std::future<void> flush(internal::ParsedFlushParams &) override;
 
+    bool supportsReadBufferView() const override;
+
 private:
     std::unique_ptr<HDF5IOHandlerImpl> m_impl;
 }; // HDF5IOHandler
@@ -28,6 +28,7 @@
 #include "openPMD/auxiliary/JSON_internal.hpp"
 
 #include <hdf5.h>
+#include <list>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -77,6 +78,8 @@ public:
     void writeAttribute(
         Writable *, Parameter<Operation::WRITE_ATT> const &) override;
     void readDataset(Writable *, Parameter<Operation::READ_DATASET> &) override;
+    void readBufferView(
+        Writable *, Parameter<Operation::READ_BUFFER_VIEW> &) override;
     void readAttribute(Writable *, Parameter<Operation::READ_ATT> &) override;
     void listPaths(Writable *, Parameter<Operation::LIST_PATHS> &) override;
     void
@@ -128,6 +131,26 @@ protected:
     nlohmann::json m_global_dataset_config;
     nlohmann::json m_global_flush_config;
 
+    /*
+     * Upper limit for the number of datasets kept open in between
+     * WRITE_DATASET/READ_DATASET tasks, configurable via
+     * hdf5.dataset_handle_cache_size. Zero disables the cache.
+     */
+    size_t m_datasetHandleCacheSize = 16;
+
+    /*
+     * Serve reads of contiguous, unfiltered datasets from a read-only memory
+     * mapping of the file instead of H5Dread, configurable via hdf5.mmap.
+     * Only used in serial read-only mode.
+     */
+    bool m_useMmap = false;
+
+    /*
+     * Close all cached dataset handles. Must be called before closing the
+     * files they belong to.
+     */
+    void invalidateDatasetHandles();
+
 private:
     struct File
     {
@@ -135,6 +158,81 @@ private:
         hid_t id;
     };
     std::optional<File> getFile(Writable *);
+
+    /*
+     * Open handles for a dataset, reused across chunk loads and stores
+     * so that H5Dopen, H5Dget_space and the datatype lookup are not repeated
+     * for each of them.
+     */
+    struct DatasetHandle
+    {
+        hid_t file = H5I_INVALID_HID;
+        hid_t dataset = H5I_INVALID_HID;
+        hid_t dataspace = H5I_INVALID_HID;
+        // memory datatype, resolved for dtype
+        Datatype dtype = Datatype::UNDEFINED;
+        hid_t datatype = H5I_INVALID_HID;
+        /*
+         * Byte offset of the raw data within the file if the dataset can be
+         * read via mmap, determined upon first use.
+         */
+        bool storageOffsetQueried = false;
+        std::optional<haddr_t> storageOffset;
+    };
+    // most recently used handle in front
+    using DatasetHandles = std::list<std::pair<Writable *, DatasetHandle>>;
+    DatasetHandles m_datasetHandles;
+    std::unordered_map<Writable *, DatasetHandles::iterator>
+        m_datasetHandlesByWritable;
+
+    DatasetHandle &getDatasetHandle(Writable *, File const &);
+    hid_t getDatasetMemoryType(DatasetHandle &, Datatype);
+    void closeDatasetHandle(DatasetHandles::iterator);
+    void invalidateDatasetHandle(Writable *);
+    void invalidateDatasetHandles(hid_t file);
+    // close least recently used handles beyond the configured cache size
+    void trimDatasetHandles();
+
+    /*
+     * Read-only memory mappings of whole files for hdf5.mmap, created upon
+     * first use and removed when closing the file.
+     * A nullptr mapping records that the file cannot be mapped.
+     */
+    struct FileMapping
+    {
+        char const *data = nullptr;
+        size_t size = 0;
+    };
+    std::unordered_map<hid_t, FileMapping> m_fileMappings;
+
+    FileMapping const &getFileMapping(File const &);
+    void unmapFile(hid_t file);
+    void unmapFiles();
+    /*
+     * Start of the dataset's raw data within the file mapping if reading
+     * it as dtype can be served from there, nullptr otherwise.
+     */
+    char const *
+    getMappedDataset(DatasetHandle &, File const &, Datatype dtype);
+
+    /*
+     * Runs of consecutive WRITE_DATASET tasks to the same dataset, merged
+     * by coalesceDatasetWrites() into the first task of each run.
+     * writeDataset() then stores the whole run with a single H5Dwrite.
+     * Disabled with an MPI communicator, since collective transfers need
+     * the same number of H5Dwrite calls on every rank.
+     */
+    std::unordered_map<
+        AbstractParameter const *,
+        std::vector<std::shared_ptr<AbstractParameter>>>
+        m_coalescedWrites;
+    void coalesceDatasetWrites();
+    void writeDatasetChunk(
+        Writable *, File const &, Parameter<Operation::WRITE_DATASET> const &);
+    void writeDatasetCoalesced(
+        Writable *,
+        File const &,
+        std::vector<Parameter<Operation::WRITE_DATASET> *> const &);
 }; // HDF5IOHandlerImpl
 #else
 class HDF5IOHandlerImpl
@@ -68,6 +68,7 @@ OPENPMDAPI_EXPORT_ENUM_CLASS(Operation){
     READ_DATASET,
     LIST_DATASETS,
     GET_BUFFER_VIEW,
+    READ_BUFFER_VIEW, //!< Read a dataset in place, from backend memory
 
     DELETE_ATT,
     WRITE_ATT,
@@ -78,7 +79,8 @@ OPENPMDAPI_EXPORT_ENUM_CLASS(Operation){
     AVAILABLE_CHUNKS, //!< Query chunks that can be loaded in a dataset
     DEREGISTER, //!< Inform the backend that an object has been deleted.
     TOUCH, //!< tell the backend that the file is to be considered active
-    SET_WRITTEN //!< tell backend to consider a file written / not written
+    SET_WRITTEN, //!< tell backend to consider a file written / not written
+    PREFETCH_FILES //!< hint that the given files are about to be opened
 }; // note: if you change the enum members here, please update
    // docs/source/dev/design.rst
 
@@ -513,6 +515,35 @@ struct OPENPMDAPI_EXPORT Parameter<Operation::GET_BUFFER_VIEW>
     std::shared_ptr<OutParameters> out = std::make_shared<OutParameters>();
 };
 
+template <>
+struct OPENPMDAPI_EXPORT Parameter<Operation::READ_BUFFER_VIEW>
+    : public AbstractParameter
+{
+    Parameter() = default;
+    Parameter(Parameter &&) = default;
+    Parameter(Parameter const &) = default;
+    Parameter &operator=(Parameter &&) = default;
+    Parameter &operator=(Parameter const &) = default;
+
+    std::unique_ptr<AbstractParameter> to_heap() && override
+    {
+        return std::unique_ptr<AbstractParameter>(
+            new Parameter<Operation::READ_BUFFER_VIEW>(std::move(*this)));
+    }
+
+    // in parameters
+    Offset offset;
+    Extent extent;
+    Datatype dtype = Datatype::UNDEFINED;
+    // out parameters
+    struct OutParameters
+    {
+        bool backendManagedBuffer = false;
+        void const *ptr = nullptr;
+    };
+    std::shared_ptr<OutParameters> out = std::make_shared<OutParameters>();
+};
+
 template <>
 struct OPENPMDAPI_EXPORT Parameter<Operation::DELETE_ATT>
     : public AbstractParameter
@@ -713,6 +744,30 @@ struct OPENPMDAPI_EXPORT Parameter<Operation::SET_WRITTEN>
     bool target_status = false;
 };
 
+template <>
+struct OPENPMDAPI_EXPORT Parameter<Operation::PREFETCH_FILES>
+    : public AbstractParameter
+{
+    explicit Parameter() = default;
+
+    Parameter(Parameter const &) = default;
+    Parameter(Parameter &&) = default;
+
+    Parameter &operator=(Parameter const &) = default;
+    Parameter &operator=(Parameter &&) = default;
+
+    std::unique_ptr<AbstractParameter> to_heap() && override
+    {
+        return std::make_unique<Parameter<Operation::PREFETCH_FILES>>(
+            std::move(*this));
+    }
+
+    //! File names as they will be passed to OPEN_FILE
+    std::vector<std::string> names;
+    //! Upper bound for the number of threads the backend may use
+    unsigned threads = 1;
+};
+
 /** @brief Self-contained description of a single IO operation.
  *
  * Contained are
@@ -165,6 +165,17 @@ public:
         Toml
     };
 
+    /*
+     * How to store the contents of datasets, selected via
+     * json.dataset.mode (toml.dataset.mode respectively).
+     */
+    enum class DatasetMode
+    {
+        Dataset, //!< nested arrays, human-readable (default)
+        Base64, //!< raw bytes, base64-encoded within the JSON tree
+        Binary //!< raw bytes in a sidecar file "<filename>.bin"
+    };
+
     explicit JSONIOHandlerImpl(
         AbstractIOHandler *,
         openPMD::json::TracingJSON config,
@@ -242,6 +253,9 @@ public:
 
     void touch(Writable *, Parameter<Operation::TOUCH> const &) override;
 
+    void prefetchFiles(
+        Writable *, Parameter<Operation::PREFETCH_FILES> const &) override;
+
     std::future<void> flush();
 
 private:
@@ -257,9 +271,29 @@ private:
 
     std::unordered_map<File, std::shared_ptr<nlohmann::json>> m_jsonVals;
 
+    // contents read ahead of time by prefetchFiles(), indexed by filename
+    // moved to m_jsonVals upon first access
+    std::unordered_map<std::string, std::shared_ptr<nlohmann::json>>
+        m_prefetchedJsonVals;
+
     // files that have logically, but not physically been written to
     std::unordered_set<File> m_dirty;
 
+    /*
+     * Journaling, activated via json.journal (toml.journal respectively).
+     * Contains an entry for each file whose state on disk (including its
+     * journal) is in sync with m_jsonVals, up to the listed changes made
+     * since then.
+     */
+    struct JournalChanges
+    {
+        // JSON pointers to values which have been replaced or removed
+        std::vector<std::string> paths;
+        // regions written to datasets, by JSON pointer to the dataset
+        std::vector<std::tuple<std::string, Offset, Extent>> hyperslabs;
+    };
+    std::unordered_map<File, JournalChanges> m_journalChanges;
+
     /*
      * Is set by constructor.
      */
@@ -267,8 +301,26 @@ private:
 
     std::string m_originalExtension;
 
+    DatasetMode m_datasetMode = DatasetMode::Dataset;
+
+    bool m_journal = false;
+
+    // json.lazy_datasets: in read-only mode, only index the "data" arrays
+    // of datasets while parsing and load them upon request
+    bool m_lazyDatasets = false;
+
     // HELPER FUNCTIONS
 
+    // read the backend configuration passed to the constructor
+    void readConfig(openPMD::json::TracingJSON &config);
+
+    // "json" or "toml", the key for this backend's configuration
+    std::string backendConfigKey() const;
+
+    // read <backend>.dataset.mode from the given configuration
+    std::optional<DatasetMode>
+    parseDatasetMode(openPMD::json::TracingJSON &config) const;
+
     // will use the IOHandler to retrieve the correct directory.
     // first tuple element will be the underlying opened file handle.
     // if Access is read mode, then the second tuple element will be the istream
@@ -315,6 +367,50 @@ private:
 
     static Extent getExtent(nlohmann::json &j);
 
+    // true if the "data" entry of a dataset holds raw bytes, either decoded
+    // in memory or as stored in base64/binary mode
+    static bool isBinaryData(nlohmann::json const &data);
+
+    // raw bytes of a dataset in base64/binary mode, decoded in place from
+    // the representation on disk upon first access
+    nlohmann::json::binary_t &binaryData(nlohmann::json &dataset, File const &);
+
+    // true if the "data" entry of a dataset has not been loaded from disk
+    // due to json.lazy_datasets
+    static bool isLazyData(nlohmann::json const &data);
+
+    // parse the "data" entry of a lazily loaded dataset from disk, replacing
+    // its placeholder, so it stays loaded until the file is closed
+    void loadLazyData(nlohmann::json &dataset, File const &);
+
+    // decode all datasets of the file that still refer to its sidecar file,
+    // needed before overwriting the sidecar file
+    void loadBinaryData(nlohmann::json &, File const &);
+
+    // replace raw bytes in the JSON value by their representation on disk,
+    // (over-)writing or appending to the given sidecar file in binary mode
+    // return the replaced nodes along with their raw bytes for restoring them
+    std::vector<std::pair<nlohmann::json *, nlohmann::json::binary_t>>
+    encodeBinaryData(
+        nlohmann::json &, std::string const &sidecarPath, bool append);
+
+    // path of the journal belonging to a file
+    std::string journalPath(File const &);
+
+    // mark the JSON value at the given pointer as modified
+    void markChanged(File const &, std::string jsonPointer);
+
+    // mark a region of the dataset at the given pointer as modified
+    void markHyperslabChanged(
+        File const &, std::string datasetPointer, Offset, Extent);
+
+    // write the changes since the last flush to the file's journal,
+    // fall back to putJsonContents() if it has no consistent state on disk
+    void appendToJournal(File const &);
+
+    // replay the journal of a file onto the contents read from disk
+    void applyJournal(nlohmann::json &, File const &);
+
     // remove single '/' in the beginning and end of a string
     static std::string removeSlashes(std::string);
 
@@ -337,6 +433,9 @@ private:
     // from disk
     std::shared_ptr<nlohmann::json> obtainJsonContents(File const &);
 
+    // read and parse the file from disk, does not modify the handler state
+    std::shared_ptr<nlohmann::json> readJsonContents(File const &);
+
     // get the json value at the writable's fileposition
     nlohmann::json &obtainJsonContents(Writable *writable);
 
@@ -131,6 +131,8 @@ class Iteration : public Attributable
     friend class WriteIterations;
     friend class SeriesIterator;
     friend class internal::AttributableData;
+    template <typename>
+    friend struct traits::GenerationPolicy;
     template <typename T>
     friend T &internal::makeOwning(T &self, Series);
 
@@ -276,6 +278,11 @@ private:
     void flushGroupBased(IterationIndex_t, internal::FlushParams const &);
     void flushVariableBased(IterationIndex_t, internal::FlushParams const &);
     void flush(internal::FlushParams const &);
+    /*
+     * Store the statistics of all record components upon closing, see
+     * RecordComponent::writeStatistics().
+     */
+    void writeStatistics(internal::SeriesData const &);
     void deferParseAccess(internal::DeferredParseAccess);
     /*
      * Control flow for runDeferredParseAccess(), readFileBased(),
@@ -401,6 +408,12 @@ private:
      *
      */
     void runDeferredParseAccess();
+
+    /*
+     * Called for newly created Iterations, see
+     * traits::GenerationPolicy<Iteration>.
+     */
+    void notifySeriesOfCreation();
 }; // Iteration
 
 extern template float Iteration::time<float>() const;
@@ -446,4 +459,18 @@ private:
         : Iteration(std::forward<Iteration_t>(it)), iterationIndex(index)
     {}
 };
+
+namespace traits
+{
+    /*
+     * A new Iteration among those that Series::flush() skips as finished
+     * must be flushed, so notify the Series.
+     */
+    template <>
+    struct GenerationPolicy<Iteration>
+    {
+        constexpr static bool is_noop = false;
+        void operator()(Iteration &);
+    };
+} // namespace traits
 } // namespace openPMD
@@ -33,6 +33,8 @@ namespace openPMD
 {
 class SeriesIterator
 {
+    friend class ReadIterations;
+
     using iteration_index_t = IndexedIteration::index_t;
 
     using maybe_series_t = std::optional<Series>;
@@ -55,6 +57,14 @@ class SeriesIterator
          * are still there and the iterations can be parsed again.
          */
         std::set<Iteration::IterationIndex_t> ignoreIterations;
+        /*
+         * Number of upcoming iterations whose files are prefetched in
+         * file-based iteration encoding, see prefetchUpcomingIterations().
+         * At most prefetchMaxBytes are prefetched per iteration.
+         */
+        unsigned prefetch = 0;
+        std::uint64_t prefetchMaxBytes = 0;
+        std::optional<iteration_index_t> prefetchedUpTo;
     };
 
     /*
@@ -139,6 +149,8 @@ private:
 
     void initSeriesInLinearReadMode();
 
+    void prefetchUpcomingIterations();
+
     void close();
 };
 
@@ -157,6 +169,11 @@ private:
  * Since this is designed for streaming mode, reopening an iteration is
  * not possible once it has been closed.
  *
+ * In file-based iteration encoding, the files of the next iterations can be
+ * prefetched into the page cache of the operating system while the current
+ * iteration is processed, see the `prefetch` option of
+ * Series::readIterations().
+ *
  */
 class ReadIterations
 {
@@ -168,11 +185,17 @@ private:
 
     Series m_series;
     std::optional<internal::ParsePreference> m_parsePreference;
+    unsigned m_prefetch = 0;
+    std::uint64_t m_prefetchMaxBytes = 0;
 
     ReadIterations(
         Series,
         Access,
-        std::optional<internal::ParsePreference> parsePreference);
+        std::optional<internal::ParsePreference> parsePreference,
+        unsigned prefetch = 0,
+        std::uint64_t prefetchMaxBytes = 0);
+
+    void applyOptions(iterator_t &);
 
 public:
     iterator_t begin();
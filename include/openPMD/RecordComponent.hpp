@@ -31,7 +31,9 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <sstream>
 #include <stdexcept>
@@ -51,10 +53,43 @@ namespace openPMD
 template <typename T>
 class DynamicMemoryView;
 
+template <typename T>
+class TypedRecordComponent;
+
 class RecordComponent;
 
+/** Summary of the values written to a RecordComponent
+ *
+ * Computed while flushing chunks if the Series was created with the
+ * "statistics" JSON option and stored as attributes when closing the
+ * Iteration, see RecordComponent::statistics().
+ */
+struct RecordComponentStatistics
+{
+    double min = 0;
+    double max = 0;
+    double mean = 0;
+    //! number of values, not counting NaNs
+    uint64_t count = 0;
+    //! equally sized bins spanning [min, max], empty if not configured
+    std::vector<uint64_t> histogram;
+};
+
 namespace internal
 {
+    /*
+     * Running statistics of the chunks flushed so far, the histogram spans
+     * [min, max] of those chunks.
+     */
+    struct StatisticsAccumulator
+    {
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+        double sum = 0;
+        uint64_t count = 0;
+        std::vector<uint64_t> histogram;
+    };
+
     class RecordComponentData : public BaseRecordComponentData
     {
     public:
@@ -99,6 +134,11 @@ namespace internal
          * flushed to the backend
          */
         bool m_hasBeenExtended = false;
+        /**
+         * Statistics of the flushed chunks if enabled for the Series,
+         * written upon closing the Iteration.
+         */
+        std::optional<StatisticsAccumulator> m_statistics;
 
         void reset() override
         {
@@ -108,6 +148,7 @@ namespace internal
             m_name = std::string();
             m_isEmpty = false;
             m_hasBeenExtended = false;
+            m_statistics.reset();
         }
     };
     template <typename, typename>
@@ -131,6 +172,8 @@ class RecordComponent : public BaseRecordComponent
     friend class Mesh;
     template <typename>
     friend class DynamicMemoryView;
+    template <typename>
+    friend class TypedRecordComponent;
     friend class internal::RecordComponentData;
     friend class MeshRecordComponent;
     template <typename T>
@@ -219,6 +262,19 @@ public:
      */
     bool empty() const;
 
+    /** Statistics of the data stored in this record component
+     *
+     * Available if the writing Series enabled the "statistics" JSON option,
+     * read from attributes without loading any data.
+     * The writer stores them when closing the Iteration, so there are none
+     * for Iterations that were never closed. Chunks written via the
+     * span-based storeChunk(Offset, Extent) into backend memory are not
+     * covered.
+     *
+     * @return The statistics, or an empty optional if none were written.
+     */
+    std::optional<RecordComponentStatistics> statistics() const;
+
     /** Load and allocate a chunk of data
      *
      * Set offset to {0u} and extent to {-1u} for full selection.
@@ -229,6 +285,31 @@ public:
     template <typename T>
     std::shared_ptr<T> loadChunk(Offset = {0u}, Extent = {-1u});
 
+    /** Load a chunk of data, preferably without copying it.
+     *
+     * Read-side equivalent of storeChunk(Offset, Extent): If the backend
+     * can serve the requested chunk from its own memory, the returned
+     * pointer refers to that memory and is usable immediately. It must then
+     * not be dereferenced after closing the current step (or the Iteration,
+     * or the Series), the pointer itself does not keep the data alive.
+     * Currently, this applies to the ADIOS2 inline engine for chunks
+     * matching a written block exactly, and to HDF5 with hdf5.mmap enabled
+     * for chunks that are contiguous in the file (valid until the file is
+     * closed, i.e. with file-based iteration encoding only until the
+     * Iteration is closed).
+     * Otherwise, this falls back to loadChunk(Offset, Extent), i.e. the
+     * returned buffer owns a copy that is only filled after the next flush.
+     * Only if the backend is configured to serve such views at all does
+     * this call flush the IO queue in order to obtain the pointer.
+     *
+     * Set offset to {0u} and extent to {-1u} for full selection.
+     *
+     * If offset is non-zero and extent is {-1u} the leftover extent in the
+     * record component will be selected.
+     */
+    template <typename T>
+    std::shared_ptr<T const> loadChunkView(Offset = {0u}, Extent = {-1u});
+
     using shared_ptr_dataset_types = auxiliary::detail::
         map_variant<auxiliary::detail::as_shared_pointer, dataset_types>::type;
 
@@ -450,6 +531,19 @@ public:
     template <typename T>
     DynamicMemoryView<T> storeChunk(Offset, Extent);
 
+    /**
+     * @brief Handle for storing and loading chunks of type T, checking the
+     *        datatype only once instead of on every call.
+     *
+     * Must be called after defining the dataset, see TypedRecordComponent.
+     *
+     * @tparam T The datatype of the dataset.
+     * @throws std::runtime_error if T does not match the dataset or the
+     *         RecordComponent is constant or empty.
+     */
+    template <typename T>
+    TypedRecordComponent<T> typed();
+
     /**
      * @brief Run a template functor on the type of the record component,
      *        similar to std::visit().
@@ -503,6 +597,38 @@ private:
     void storeChunk(
         auxiliary::WriteBuffer buffer, Datatype datatype, Offset o, Extent e);
 
+    /**
+     * Buffers allocated by the openPMD API for loadChunk() and
+     * storeChunk(Offset, Extent), drawn from the Series' buffer pool.
+     */
+    template <typename T>
+    std::shared_ptr<T> allocateBuffer(size_t numPoints);
+
+    std::shared_ptr<void> acquireBuffer(size_t bytes);
+
+    /**
+     * Add the values of chunks about to be written to the running
+     * statistics, see internal::SeriesData::m_computeStatistics.
+     */
+    void accumulateStatistics(
+        std::vector<Parameter<Operation::WRITE_DATASET> const *> const &,
+        size_t histogramBins);
+    /**
+     * Add the values of chunks enqueued in this component, but not yet
+     * flushed, to the running statistics.
+     */
+    void accumulatePendingStatistics(size_t histogramBins);
+    /**
+     * Reduce the running statistics of an Iteration's record components
+     * (keyed by their path within the Iteration) across MPI ranks, if any,
+     * and store them as attributes. To be called when closing the Iteration.
+     * Collective: the ranks first agree on the union of their components,
+     * ranks that did not define one of them contribute empty statistics.
+     */
+    static void writeStatistics(
+        std::map<std::string, RecordComponent> &components,
+        internal::SeriesData const &);
+
     // clang-format off
 OPENPMD_protected
     // clang-format on
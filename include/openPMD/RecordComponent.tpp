@@ -23,6 +23,7 @@
 
 #include "openPMD/RecordComponent.hpp"
 #include "openPMD/Span.hpp"
+#include "openPMD/TypedRecordComponent.hpp"
 #include "openPMD/auxiliary/Memory.hpp"
 #include "openPMD/auxiliary/ShareRawInternal.hpp"
 #include "openPMD/auxiliary/TypeTraits.hpp"
@@ -80,17 +81,76 @@ inline std::shared_ptr<T> RecordComponent::loadChunk(Offset o, Extent e)
     for (auto const &dimensionSize : extent)
         numPoints *= dimensionSize;
 
-#if (defined(_LIBCPP_VERSION) && _LIBCPP_VERSION < 11000) ||                   \
-    (defined(__apple_build_version__) && __clang_major__ < 14)
-    auto newData =
-        std::shared_ptr<T>(new T[numPoints], [](T *p) { delete[] p; });
+    auto newData = allocateBuffer<T>(numPoints);
     loadChunk(newData, offset, extent);
     return newData;
+}
+
+template <typename T>
+inline std::shared_ptr<T const>
+RecordComponent::loadChunkView(Offset o, Extent e)
+{
+    if (constant() || determineDatatype<T>() != getDatatype() ||
+        !IOHandler()->supportsReadBufferView())
+    {
+        return loadChunk<T>(std::move(o), std::move(e));
+    }
+
+    uint8_t dim = getDimensionality();
+
+    // default arguments
+    //   offset = {0u}: expand to right dim {0u, 0u, ...}
+    Offset offset = o;
+    if (o.size() == 1u && o.at(0) == 0u && dim > 1u)
+        offset = Offset(dim, 0u);
+
+    //   extent = {-1u}: take full size
+    Extent extent(dim, 1u);
+    if (e.size() == 1u && e.at(0) == -1u)
+    {
+        extent = getExtent();
+        for (uint8_t i = 0u; i < dim; ++i)
+            extent[i] -= offset[i];
+    }
+    else
+        extent = e;
+
+    Parameter<Operation::READ_BUFFER_VIEW> readBufferView;
+    readBufferView.offset = offset;
+    readBufferView.extent = extent;
+    readBufferView.dtype = getDatatype();
+    IOHandler()->enqueue(IOTask(this, readBufferView));
+    IOHandler()->flush(internal::defaultFlushParams);
+    auto &out = *readBufferView.out;
+    if (out.backendManagedBuffer)
+    {
+        // memory owned by the backend, nothing to free here
+        return std::shared_ptr<T const>(
+            static_cast<T const *>(out.ptr), [](T const *) {});
+    }
+    return loadChunk<T>(std::move(offset), std::move(extent));
+}
+
+template <typename T>
+inline std::shared_ptr<T> RecordComponent::allocateBuffer(size_t numPoints)
+{
+    if constexpr (std::is_trivially_destructible_v<T>)
+    {
+        auto buffer = acquireBuffer(numPoints * sizeof(T));
+        auto data = static_cast<T *>(buffer.get());
+        std::uninitialized_default_construct_n(data, numPoints);
+        return std::shared_ptr<T>(std::move(buffer), data);
+    }
+    else
+    {
+#if (defined(_LIBCPP_VERSION) && _LIBCPP_VERSION < 11000) ||                   \
+    (defined(__apple_build_version__) && __clang_major__ < 14)
+        return std::shared_ptr<T>(new T[numPoints], [](T *p) { delete[] p; });
 #else
-    auto newData = std::shared_ptr<T[]>(new T[numPoints]);
-    loadChunk(newData, offset, extent);
-    return std::static_pointer_cast<T>(std::move(newData));
+        return std::static_pointer_cast<T>(
+            std::shared_ptr<T[]>(new T[numPoints]));
 #endif
+    }
 }
 
 template <typename T>
@@ -345,14 +405,10 @@ template <typename T>
 inline DynamicMemoryView<T>
 RecordComponent::storeChunk(Offset offset, Extent extent)
 {
-    return storeChunk<T>(std::move(offset), std::move(extent), [](size_t size) {
-#if (defined(_LIBCPP_VERSION) && _LIBCPP_VERSION < 11000) ||                   \
-    (defined(__apple_build_version__) && __clang_major__ < 14)
-        return std::shared_ptr<T>{new T[size], [](auto *ptr) { delete[] ptr; }};
-#else
-            return std::shared_ptr< T[] >{ new T[ size ] };
-#endif
-    });
+    return storeChunk<T>(
+        std::move(offset), std::move(extent), [this](size_t size) {
+            return allocateBuffer<T>(size);
+        });
 }
 
 namespace detail
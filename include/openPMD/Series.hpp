@@ -28,6 +28,7 @@
 #include "openPMD/IterationEncoding.hpp"
 #include "openPMD/Streaming.hpp"
 #include "openPMD/WriteIterations.hpp"
+#include "openPMD/auxiliary/BufferPool.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/backend/Attributable.hpp"
 #include "openPMD/backend/Container.hpp"
@@ -180,6 +181,74 @@ namespace internal
          * True if a user opts into lazy parsing.
          */
         bool m_parseLazily = false;
+        /**
+         * File-based encoding only: list the iterations and read the cached
+         * hierarchy from the sidecar metadata index if it is up to date,
+         * (re)generate it when closing the Series otherwise.
+         * Set by the "metadata_index" JSON option.
+         */
+        bool m_useMetadataIndex = false;
+        /**
+         * File-based encoding only: when parsing eagerly, let the backend
+         * prefetch batches of this many files concurrently.
+         * Set by the "iteration_parsing.threads" JSON option, values below 2
+         * parse strictly sequentially.
+         */
+        unsigned m_iterationParsingThreads = 0;
+        /**
+         * Paths relative to an iteration (e.g. "meshes/E",
+         * "particles/e/position") that restrict which meshes, particle
+         * species and particle records are read.
+         * Set by the "read_filter" JSON option, empty for reading everything.
+         */
+        std::vector<std::string> m_readFilter;
+
+        /**
+         * Whether the object at the given path (relative to an iteration)
+         * needs to be read, i.e. it, one of its ancestors or one of its
+         * descendants is listed in m_readFilter.
+         */
+        bool passesReadFilter(std::string const &path) const;
+
+        /**
+         * Buffers allocated by loadChunk() and storeChunk(Offset, Extent).
+         * Configured by the "buffer_pool" JSON option, pools nothing by
+         * default.
+         */
+        auxiliary::BufferPool m_bufferPool;
+
+        /**
+         * Compute statistics of the data written to record components and
+         * store them as attributes when closing the iteration.
+         * Set by the "statistics" JSON option, disabled by default.
+         */
+        bool m_computeStatistics = false;
+        //! Number of histogram bins in these statistics, zero for none
+        size_t m_statisticsHistogramBins = 0;
+
+        /**
+         * Drop meshes and particles of iterations once they have been closed
+         * in the backend, keeping only a stub with the index, close status
+         * and iteration attributes.
+         * Set by the "evict_closed_iterations" JSON option, disabled by
+         * default.
+         */
+        bool m_evictClosedIterations = false;
+        /**
+         * Iterations closed in the backend by the last flush, evicted at the
+         * beginning of the next flush once no IO tasks refer to them anymore.
+         */
+        std::vector<IterationIndex_t> m_iterationsToEvict;
+        /**
+         * All iterations up to this index have been closed in the backend
+         * and not been modified since, so flushing the whole Series starts
+         * after it, see Series::skipFinishedIterations().
+         * Reset when one of them is modified or a new iteration is created
+         * in that range.
+         */
+        std::optional<IterationIndex_t> m_finishedUpTo;
+        //! Number of iterations up to m_finishedUpTo.
+        size_t m_finishedCount = 0;
 
         /**
          * In variable-based encoding, all backends except ADIOS2 can only write
@@ -250,6 +319,8 @@ class Series : public Attributable
 {
     friend class Attributable;
     friend class Iteration;
+    friend class ParticleSpecies;
+    friend class RecordComponent;
     friend class Writable;
     friend class ReadIterations;
     friend class SeriesIterator;
@@ -619,6 +690,13 @@ public:
     std::string backend() const;
     std::string backend();
 
+    /** Usage counters of the pool that buffers allocated by loadChunk() and
+     *  storeChunk(Offset, Extent) are drawn from
+     *
+     * The pool is configured by the JSON/TOML key "buffer_pool".
+     */
+    auxiliary::BufferPoolStatistics bufferPoolStatistics() const;
+
     /** Execute all required remaining IO operations to write or read data.
      *
      * @param backendConfig Further backend-specific instructions on how to
@@ -628,6 +706,25 @@ public:
      */
     void flush(std::string backendConfig = "{}");
 
+    /** Execute all required remaining IO operations to write or read data.
+     *
+     * @param backendConfig Backend configuration as returned by
+     *                      prepareFlushConfig(), for flushing repeatedly
+     *                      without parsing the configuration every time.
+     */
+    void flush(FlushConfig const &backendConfig);
+
+    /** Parse a backend configuration for Series::flush() once.
+     *
+     * @param backendConfig Further backend-specific instructions on how to
+     *                      implement flush calls, see flush(std::string).
+     *                      Must be provided in-line, configuration is not read
+     *                      from files.
+     * @return The parsed configuration, may be passed to
+     *         flush(FlushConfig const &) as often as needed.
+     */
+    FlushConfig prepareFlushConfig(std::string const &backendConfig) const;
+
     /**
      * @brief Entry point to the reading end of the streaming API.
      *
@@ -641,9 +738,17 @@ public:
      * `Series::iterations` can be accessed directly.
      * Look for the ReadIterations class for further documentation.
      *
+     * @param options JSON/TOML configuration for the iterator. The key
+     *        `prefetch` specifies how many upcoming iterations of a
+     *        file-based Series are prefetched into the page cache of the
+     *        operating system while the current one is processed
+     *        (default: 0), e.g. `{"prefetch": 2}`. `prefetch_max_bytes`
+     *        limits the bytes prefetched per iteration (default: 64 MiB),
+     *        starting with the smallest files, so that large outputs do not
+     *        evict the data of the current iteration from the page cache.
      * @return ReadIterations
      */
-    ReadIterations readIterations();
+    ReadIterations readIterations(std::string const &options = "{}");
 
     /**
      * @brief Parse the Series.
@@ -742,8 +847,8 @@ OPENPMD_private
     /**
      * @brief Parse non-backend-specific configuration in JSON config.
      *
-     * Currently this parses the keys defer_iteration_parsing, backend and
-     * iteration_encoding.
+     * Currently this parses the keys defer_iteration_parsing, backend,
+     * iteration_encoding, rank_table and async.
      *
      * @tparam TracingJSON template parameter so we don't have
      *         to include the JSON lib here
@@ -839,6 +944,42 @@ OPENPMD_private
      */
     IterationOpened
     openIterationIfDirty(IterationIndex_t index, Iteration iteration);
+
+    /*
+     * True if flushing has nothing to do for the iteration, i.e. it has been
+     * closed in the backend and not been modified since, or its parsing is
+     * still deferred and the Series itself has not been modified.
+     * O(1), does not copy the Iteration handle.
+     */
+    bool flushIsNoop(Iteration const &);
+
+    /*
+     * When flushing the whole Series, the first iteration after those that
+     * are known to be finished (SeriesData::m_finishedUpTo), otherwise begin.
+     * O(number of iterations after the finished ones).
+     */
+    iterations_iterator
+    skipFinishedIterations(iterations_iterator begin, iterations_iterator end);
+    /*
+     * After flushing the whole Series, extend SeriesData::m_finishedUpTo by
+     * the finished iterations starting at `from`, the iterator returned by
+     * skipFinishedIterations().
+     */
+    void updateFinishedIterations(
+        iterations_iterator begin,
+        iterations_iterator end,
+        iterations_iterator from);
+
+    /*
+     * Drop the object model below the iterations scheduled in
+     * SeriesData::m_iterationsToEvict, if the IO queue is empty.
+     */
+    void evictClosedIterations();
+
+    /*
+     * Called when an iteration has been closed in the backend while writing.
+     */
+    void iterationClosedInBackend(IterationIndex_t);
     /*
      * Open an iteration. Ensures that the iteration's m_closed status
      * is set properly and that any files pertaining to the iteration
@@ -850,6 +991,7 @@ OPENPMD_private
     /**
      * Find the given iteration in Series::iterations and return an iterator
      * into Series::iterations at that place.
+     * O(log n) by looking up the key stored in the iteration's Writable.
      */
     iterations_iterator indexOf(Iteration const &);
 
@@ -0,0 +1,193 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/Error.hpp"
+#include "openPMD/RecordComponent.hpp"
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace openPMD
+{
+/**
+ * @brief Handle for storing and loading chunks of a RecordComponent whose
+ *        datatype is fixed at compile time.
+ *
+ * Obtained via RecordComponent::typed<T>() after the dataset has been
+ * defined (RecordComponent::resetDataset() or reading it), which checks
+ * once that the RecordComponent is a regular dataset of type T.
+ * storeChunk() and loadChunk() then only check the chunk against the
+ * current extent of the dataset and enqueue the IO task, avoiding the
+ * repeated datatype resolution of the RecordComponent API. This pays off
+ * for loops over many small chunks.
+ *
+ * Unlike RecordComponent::loadChunk(), no conversion between types of
+ * equivalent representation is done, T must match the dataset exactly.
+ * The handle stays valid across RecordComponent::resetDataset() calls that
+ * only change the extent.
+ *
+ * @tparam T The datatype of the dataset.
+ */
+template <typename T>
+class TypedRecordComponent
+{
+    friend class RecordComponent;
+
+public:
+    using value_type = T;
+
+    /** Store a chunk of data, see RecordComponent::storeChunk().
+     */
+    void storeChunk(std::shared_ptr<T const> data, Offset offset, Extent extent)
+    {
+        if (!data)
+            throw std::runtime_error(
+                "Unallocated pointer passed during chunk store.");
+        verifyChunk(offset, extent);
+
+        Parameter<Operation::WRITE_DATASET> dWrite;
+        dWrite.offset = std::move(offset);
+        dWrite.extent = std::move(extent);
+        dWrite.dtype = m_datatype;
+        dWrite.data =
+            auxiliary::WriteBuffer(std::static_pointer_cast<void const>(data));
+        m_recordComponent.get().push_chunk(
+            IOTask(&m_recordComponent, std::move(dWrite)));
+    }
+
+    /** Store a chunk of data from a raw pointer, see
+     *  RecordComponent::storeChunkRaw().
+     */
+    void storeChunkRaw(T const *data, Offset offset, Extent extent)
+    {
+        storeChunk(
+            std::shared_ptr<T const>(data, [](auto const *) {}),
+            std::move(offset),
+            std::move(extent));
+    }
+
+    /** Load a chunk of data into a preallocated buffer, see
+     *  RecordComponent::loadChunk().
+     */
+    void loadChunk(std::shared_ptr<T> data, Offset offset, Extent extent)
+    {
+        if (!data)
+            throw std::runtime_error(
+                "Unallocated pointer passed during chunk loading.");
+        verifyChunk(offset, extent);
+
+        Parameter<Operation::READ_DATASET> dRead;
+        dRead.offset = std::move(offset);
+        dRead.extent = std::move(extent);
+        dRead.dtype = m_datatype;
+        dRead.data = std::static_pointer_cast<void>(data);
+        m_recordComponent.get().push_chunk(
+            IOTask(&m_recordComponent, std::move(dRead)));
+    }
+
+    /** Load a chunk of data into a preallocated raw buffer, see
+     *  RecordComponent::loadChunkRaw().
+     */
+    void loadChunkRaw(T *data, Offset offset, Extent extent)
+    {
+        loadChunk(
+            std::shared_ptr<T>(data, [](auto const *) {}),
+            std::move(offset),
+            std::move(extent));
+    }
+
+    RecordComponent &recordComponent()
+    {
+        return m_recordComponent;
+    }
+
+private:
+    explicit TypedRecordComponent(RecordComponent rc)
+        : m_recordComponent(std::move(rc))
+    {
+        auto const &data = m_recordComponent.get();
+        if (data.m_isConstant || data.m_isEmpty)
+        {
+            throw std::runtime_error(
+                "Chunks cannot be written or read for a constant or empty "
+                "RecordComponent.");
+        }
+        if (!data.m_dataset.has_value())
+        {
+            throw error::WrongAPIUsage(
+                "[RecordComponent] Must specify dataset type and extent before "
+                "using typed() (see RecordComponent::resetDataset()).");
+        }
+        if (data.m_dataset->dtype != m_datatype)
+        {
+            std::ostringstream oss;
+            oss << "Datatypes of typed handle (" << m_datatype
+                << ") and record component (" << data.m_dataset->dtype
+                << ") do not match.";
+            throw std::runtime_error(oss.str());
+        }
+    }
+
+    /*
+     * Fast path for the common case of an unchanged, regular dataset.
+     * Anything else goes through RecordComponent::verifyChunk(), which
+     * also produces the error messages.
+     */
+    void verifyChunk(Offset const &offset, Extent const &extent) const
+    {
+        auto const &data = m_recordComponent.get();
+        auto const &dataset = data.m_dataset;
+        if (dataset.has_value() && dataset->dtype == m_datatype &&
+            !data.m_isConstant && !data.m_isEmpty &&
+            offset.size() == dataset->extent.size() &&
+            extent.size() == dataset->extent.size())
+        {
+            auto const &dse = dataset->extent;
+            bool fits = true;
+            for (size_t i = 0; i < dse.size(); ++i)
+            {
+                if (dse[i] == Dataset::JOINED_DIMENSION ||
+                    dse[i] < offset[i] + extent[i])
+                {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits)
+            {
+                return;
+            }
+        }
+        m_recordComponent.verifyChunk(m_datatype, offset, extent);
+    }
+
+    RecordComponent m_recordComponent;
+    static constexpr Datatype m_datatype = determineDatatype<T>();
+};
+
+template <typename T>
+inline TypedRecordComponent<T> RecordComponent::typed()
+{
+    return TypedRecordComponent<T>(*this);
+}
+} // namespace openPMD
@@ -0,0 +1,75 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace openPMD
+{
+namespace auxiliary
+{
+    /** Usage counters of a BufferPool
+     */
+    struct BufferPoolStatistics
+    {
+        //! buffers newly allocated from the system
+        std::uint64_t allocations = 0;
+        //! buffers handed out again from the pool
+        std::uint64_t reuses = 0;
+        //! buffers put back into the pool after their last user dropped them
+        std::uint64_t releases = 0;
+        //! buffers freed after their last use since the pool was full
+        std::uint64_t discards = 0;
+        //! bytes currently held by the pool for reuse
+        std::uint64_t pooledBytes = 0;
+    };
+
+    /** Thread-safe pool of byte buffers, organized in size classes
+     *
+     * Buffers are handed out as shared pointers whose deleter puts them back
+     * into the pool, from where they are reused for requests of the same
+     * size class (the requested size rounded up to the next power of two).
+     * Returned buffers are freed instead if the pool would then hold more
+     * than maxPooledBytes, so a pool with maxPooledBytes == 0 behaves like
+     * plain allocation (without rounding up the size).
+     * Buffers may outlive the pool.
+     */
+    class BufferPool
+    {
+    public:
+        explicit BufferPool(std::uint64_t maxPooledBytes = 0);
+
+        /** A buffer of at least the given size, aligned for any scalar type
+         */
+        std::shared_ptr<void> acquire(std::size_t bytes);
+
+        void setMaxPooledBytes(std::uint64_t maxPooledBytes);
+
+        BufferPoolStatistics statistics() const;
+
+    private:
+        struct Data;
+        std::shared_ptr<Data> m_data;
+    };
+} // namespace auxiliary
+} // namespace openPMD
@@ -20,6 +20,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -95,6 +97,39 @@ namespace auxiliary
      */
     bool remove_file(std::string const &path);
 
+    /** Size and last modification time of a file or directory.
+     */
+    struct FileStatus
+    {
+        std::uint64_t size = 0;
+        /** Nanoseconds since the epoch, or as precise as the platform allows.
+         */
+        std::int64_t modificationTime = 0;
+    };
+
+    /** Query size and modification time of a file or directory.
+     *
+     * @note    The equivalent of `stat path`.
+     * @param   path    Absolute or relative path to examine.
+     * @return  The status of the given path, or an empty optional if it
+     * cannot be examined.
+     */
+    std::optional<FileStatus> file_status(std::string const &path);
+
+    /** Ask the operating system to asynchronously load (the beginning of) a
+     * file into its page cache, so that a later read does not wait for the
+     * storage device.
+     *
+     * @note    Directories are prefetched recursively, smallest files first.
+     * @note    Does nothing on platforms without posix_fadvise().
+     * @param   path    Absolute or relative path to the file or directory.
+     * @param   maxBytes    Upper limit for the total number of bytes to
+     *                      prefetch, so that prefetching does not evict data
+     *                      that is currently in use.
+     * @return  The number of bytes for which prefetching was started.
+     */
+    std::uint64_t prefetch_file(std::string const &path, std::uint64_t maxBytes);
+
 #if openPMD_HAVE_MPI
 
     std::string collective_file_read(std::string const &path, MPI_Comm);
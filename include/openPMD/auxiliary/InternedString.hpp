@@ -0,0 +1,103 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace openPMD
+{
+namespace auxiliary
+{
+    /** Shared handle to an immutable string from a process-wide table
+     *
+     * All handles to equal strings share one allocation, so copying,
+     * comparing and hashing handles are O(1) pointer operations.
+     * The table is thread-safe and reference-counted: a string leaves the
+     * table when its last handle is destroyed.
+     * The empty string needs no table entry.
+     */
+    class InternedString
+    {
+    public:
+        InternedString() = default;
+        InternedString(std::string_view);
+        InternedString(std::string const &);
+        InternedString(char const *);
+
+        std::string const &str() const;
+        operator std::string const &() const
+        {
+            return str();
+        }
+
+        char const *data() const
+        {
+            return str().data();
+        }
+        std::size_t size() const
+        {
+            return str().size();
+        }
+        bool empty() const
+        {
+            return !m_entry;
+        }
+
+        bool operator==(InternedString const &other) const
+        {
+            return m_entry == other.m_entry;
+        }
+        bool operator!=(InternedString const &other) const
+        {
+            return m_entry != other.m_entry;
+        }
+
+        std::size_t hash() const
+        {
+            return std::hash<void const *>()(m_entry.get());
+        }
+
+        /** Number of distinct strings currently in the table
+         */
+        static std::size_t tableSize();
+
+    private:
+        std::shared_ptr<std::string const> m_entry;
+    };
+
+    std::ostream &operator<<(std::ostream &, InternedString const &);
+} // namespace auxiliary
+} // namespace openPMD
+
+template <>
+struct std::hash<openPMD::auxiliary::InternedString>
+{
+    std::size_t
+    operator()(openPMD::auxiliary::InternedString const &s) const noexcept
+    {
+        return s.hash();
+    }
+};
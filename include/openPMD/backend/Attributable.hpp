@@ -24,6 +24,7 @@
 #include "openPMD/ThrowError.hpp"
 #include "openPMD/auxiliary/OutOfRangeMsg.hpp"
 #include "openPMD/backend/Attribute.hpp"
+#include "openPMD/backend/AttributeMap.hpp"
 #include "openPMD/backend/Writable.hpp"
 
 #include <cstddef>
@@ -69,7 +70,7 @@ namespace internal
         AttributableData &operator=(AttributableData const &) = delete;
         AttributableData &operator=(AttributableData &&) = delete;
 
-        using A_MAP = std::map<std::string, Attribute>;
+        using A_MAP = AttributeMap;
         /**
          * The Writable associated with this Attributable.
          * There is a one-to-one relation between Attributable and Writable
@@ -154,7 +155,7 @@ namespace debug
 class Attributable
 {
     // @todo remove unnecessary friend (wew that sounds bitter)
-    using A_MAP = std::map<std::string, Attribute>;
+    using A_MAP = internal::AttributeMap;
     friend Writable *getWritable(Attributable *);
     template <typename T_elem>
     friend class BaseRecord;
@@ -486,18 +487,38 @@ OPENPMD_protected
         w.dirtyRecursive = dirty_in;
         if (dirty_in)
         {
+            if (w.skippedByFlush)
+            {
+                stopSkippingInFlush(w);
+            }
             auto current = w.parent;
             while (current && !current->dirtyRecursive)
             {
+                if (current->skippedByFlush)
+                {
+                    stopSkippingInFlush(*current);
+                }
                 current->dirtyRecursive = true;
                 current = current->parent;
             }
         }
     }
+    /*
+     * Called for an Iteration that Series::flush() has been skipping, when
+     * it becomes dirty again.
+     */
+    static void stopSkippingInFlush(Writable &iteration);
     bool written() const
     {
+        awaitBackendUpdates();
         return writable().written;
     }
+    /*
+     * The `written` flag and the file position of a Writable are updated by
+     * the backend, so a flush running in the background must be awaited
+     * before the frontend inspects or modifies them.
+     */
+    void awaitBackendUpdates() const;
     enum class EnqueueAsynchronously : bool
     {
         Yes,
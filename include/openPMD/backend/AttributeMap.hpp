@@ -0,0 +1,161 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/backend/Attribute.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace openPMD::internal
+{
+/**
+ * @brief Attributes of an Attributable, sorted by key in contiguous memory.
+ *
+ * Objects in the openPMD hierarchy typically carry a handful of attributes
+ * only. A binary search over one vector is faster for these and needs one
+ * allocation instead of one tree node per attribute as in std::map.
+ * The standard openPMD attribute names (unitSI, unitDimension, timeOffset,
+ * ...) are short enough to be stored inline in the key strings.
+ *
+ * Implements the subset of the std::map interface used by Attributable.
+ * Unlike std::map, insertion and erasure invalidate iterators.
+ */
+class AttributeMap
+{
+public:
+    using key_type = std::string;
+    using mapped_type = Attribute;
+    using value_type = std::pair<std::string, Attribute>;
+    using container_type = std::vector<value_type>;
+    using iterator = container_type::iterator;
+    using const_iterator = container_type::const_iterator;
+    using size_type = container_type::size_type;
+    using key_compare = std::less<>;
+
+    iterator begin() noexcept
+    {
+        return m_entries.begin();
+    }
+    const_iterator begin() const noexcept
+    {
+        return m_entries.begin();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return m_entries.cbegin();
+    }
+    iterator end() noexcept
+    {
+        return m_entries.end();
+    }
+    const_iterator end() const noexcept
+    {
+        return m_entries.end();
+    }
+    const_iterator cend() const noexcept
+    {
+        return m_entries.cend();
+    }
+
+    size_type size() const noexcept
+    {
+        return m_entries.size();
+    }
+    bool empty() const noexcept
+    {
+        return m_entries.empty();
+    }
+    key_compare key_comp() const
+    {
+        return key_compare{};
+    }
+
+    iterator lower_bound(std::string_view key)
+    {
+        return std::lower_bound(
+            m_entries.begin(), m_entries.end(), key, CompareKey{});
+    }
+    const_iterator lower_bound(std::string_view key) const
+    {
+        return std::lower_bound(
+            m_entries.begin(), m_entries.end(), key, CompareKey{});
+    }
+
+    iterator find(std::string_view key)
+    {
+        auto it = lower_bound(key);
+        return it != m_entries.end() && it->first == key ? it
+                                                         : m_entries.end();
+    }
+    const_iterator find(std::string_view key) const
+    {
+        auto it = lower_bound(key);
+        return it != m_entries.end() && it->first == key ? it
+                                                         : m_entries.end();
+    }
+
+    /**
+     * Insert a new element before hint, which must be the lower_bound() of
+     * its key, e.g. after a failed lookup.
+     */
+    iterator emplace_hint(const_iterator hint, value_type value)
+    {
+        return m_entries.insert(hint, std::move(value));
+    }
+
+    iterator erase(const_iterator it)
+    {
+        return m_entries.erase(it);
+    }
+    size_type erase(std::string_view key)
+    {
+        auto it = find(key);
+        if (it == m_entries.end())
+        {
+            return 0;
+        }
+        m_entries.erase(it);
+        return 1;
+    }
+
+    void clear() noexcept
+    {
+        m_entries.clear();
+    }
+
+private:
+    struct CompareKey
+    {
+        bool operator()(value_type const &entry, std::string_view key) const
+        {
+            return std::string_view(entry.first) < key;
+        }
+    };
+
+    container_type m_entries;
+};
+} // namespace openPMD::internal
@@ -24,6 +24,7 @@
 #include "openPMD/Error.hpp"
 #include "openPMD/backend/Attributable.hpp"
 
+#include <functional>
 #include <optional>
 
 // expose private and protected members for invasive testing
@@ -164,6 +165,27 @@ public:
      */
     ChunkTable availableChunks();
 
+    /**
+     * Get those available data chunks whose values may satisfy a predicate.
+     *
+     * Like availableChunks(), but skips chunks whose value bounds
+     * (WrittenChunkInfo::valueBounds) are known and rejected by the filter,
+     * so e.g. only blocks that may contain high-energy particles are read:
+     *
+     *     rc.availableChunks([](double min, double max) { return max > 1e9; })
+     *
+     * Bounds are reported per chunk by ADIOS2 if the writer enabled its
+     * statistics (StatsLevel). Otherwise, the bounds of the whole record
+     * component from RecordComponent::statistics() apply to each chunk, if
+     * available. Chunks without any known bounds are always returned.
+     *
+     * @param filter Called with the minimum and maximum of a chunk's values,
+     *               returns false if no value within these bounds is of
+     *               interest.
+     */
+    ChunkTable availableChunks(
+        std::function<bool(double min, double max)> const &filter);
+
 protected:
     using Data_t = internal::BaseRecordComponentData;
     std::shared_ptr<Data_t> m_baseRecordComponentData;
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/auxiliary/InternedString.hpp"
 
 #include <memory>
 #include <string>
@@ -50,6 +51,7 @@ namespace internal
 {
     class AttributableData;
     class SeriesData;
+    struct MetadataCache;
 } // namespace internal
 namespace detail
 {
@@ -75,6 +77,7 @@ class Writable final
 {
     friend class internal::AttributableData;
     friend class internal::SeriesData;
+    friend struct internal::MetadataCache;
     friend class Attributable;
     template <typename T_elem>
     friend class BaseRecord;
@@ -161,11 +164,20 @@ OPENPMD_private
      * Attributable::setDirtyRecursive().
      */
     bool dirtyRecursive = true;
+    /**
+     * Set on Iterations that Series::flush() skips since they are finished,
+     * see internal::SeriesData::m_finishedUpTo.
+     * Attributable::setDirtyRecursive() notifies the Series when such an
+     * Iteration is modified again.
+     */
+    bool skippedByFlush = false;
     /**
      * If parent is not null, then this is a key such that:
      * &(*parent)[key] == this
+     * Interned, since the same record and component names recur in every
+     * iteration.
      */
-    std::string ownKeyWithinParent;
+    auxiliary::InternedString ownKeyWithinParent;
     /**
      * @brief Whether a Writable has been written to the backend.
      *
@@ -36,12 +36,16 @@ namespace cli
     {
         inline void print_help(std::string const &program_name)
         {
-            std::cout << "Usage: " << program_name << " openPMD-series\n";
+            std::cout << "Usage: " << program_name
+                      << " [--write-index] openPMD-series\n";
             std::cout << "List information about an openPMD data series.\n\n";
             std::cout << "Options:\n";
             std::cout << "    -h, --help    display this help and exit\n";
             std::cout
                 << "    -v, --version output version information and exit\n";
+            std::cout << "    --write-index store a metadata index next to a "
+                         "file-based series\n"
+                         "                  for faster subsequent opening\n";
             std::cout << "\n";
             std::cout << "Examples:\n";
             std::cout << "    " << program_name
@@ -99,19 +103,36 @@ namespace cli
                 }
             }
 
-            if (argc > 2)
+            std::vector<std::string> positional;
+            bool writeIndex = false;
+            for (int c = 1; c < int(argc); c++)
+            {
+                if (std::string("--write-index") == argv[c])
+                {
+                    writeIndex = true;
+                }
+                else
+                {
+                    positional.push_back(argv[c]);
+                }
+            }
+
+            if (positional.size() != 1)
             {
-                std::cerr << "Too many arguments! See: " << argv[0]
-                          << " --help\n";
+                std::cerr << (positional.empty() ? "Missing series! See: "
+                                                 : "Too many arguments! See: ")
+                          << argv[0] << " --help\n";
                 return 1;
             }
 
             try
             {
                 auto s = Series(
-                    argv[1],
+                    positional[0],
                     Access::READ_ONLY,
-                    R"({"defer_iteration_parsing": true})");
+                    // parse all iterations so their hierarchy is indexed
+                    writeIndex ? R"({"metadata_index": true})"
+                               : R"({"defer_iteration_parsing": true})");
 
                 helper::listSeries(s, true, std::cout);
             }
@@ -23,6 +23,10 @@
 
 #include "openPMD/auxiliary/Mpi.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #ifdef _WIN32
@@ -62,6 +66,509 @@ bool WrittenChunkInfo::operator==(WrittenChunkInfo const &other) const
         this->ChunkInfo::operator==(other);
 }
 
+namespace chunk_assignment
+{
+    namespace
+    {
+        Extent::value_type volume(ChunkInfo const &chunk)
+        {
+            Extent::value_type res = 1;
+            for (auto ext : chunk.extent)
+            {
+                res *= ext;
+            }
+            return res;
+        }
+
+        void appendAssignment(Assignment &into, Assignment from)
+        {
+            for (auto &[rank, chunks] : from)
+            {
+                auto &target = into[rank];
+                target.insert(
+                    target.end(),
+                    std::make_move_iterator(chunks.begin()),
+                    std::make_move_iterator(chunks.end()));
+            }
+        }
+
+        void verifyReadingRanks(RankMeta const &rankMetaOut, char const *who)
+        {
+            if (rankMetaOut.empty())
+            {
+                throw std::runtime_error(
+                    std::string("[") + who +
+                    "] Cannot distribute chunks to zero reading ranks.");
+            }
+        }
+
+        /*
+         * Chunks are mergeable along dim if they agree in everything but
+         * their offset along dim.
+         * Order them such that these candidates become neighbors,
+         * sorted by that offset.
+         */
+        bool lessForMerging(
+            WrittenChunkInfo const &left,
+            WrittenChunkInfo const &right,
+            size_t dim)
+        {
+            if (left.sourceID != right.sourceID)
+            {
+                return left.sourceID < right.sourceID;
+            }
+            for (size_t d = 0; d < left.offset.size(); ++d)
+            {
+                if (d == dim)
+                {
+                    continue;
+                }
+                if (left.offset[d] != right.offset[d])
+                {
+                    return left.offset[d] < right.offset[d];
+                }
+                if (left.extent[d] != right.extent[d])
+                {
+                    return left.extent[d] < right.extent[d];
+                }
+            }
+            return left.offset[dim] < right.offset[dim];
+        }
+
+        bool mergeableAlong(
+            WrittenChunkInfo const &left,
+            WrittenChunkInfo const &right,
+            size_t dim)
+        {
+            if (left.sourceID != right.sourceID ||
+                left.offset[dim] + left.extent[dim] != right.offset[dim])
+            {
+                return false;
+            }
+            for (size_t d = 0; d < left.offset.size(); ++d)
+            {
+                if (d != dim &&
+                    (left.offset[d] != right.offset[d] ||
+                     left.extent[d] != right.extent[d]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace
+
+    void mergeChunks(ChunkTable &table)
+    {
+        if (table.empty())
+        {
+            return;
+        }
+        size_t const dimensionality = table.front().offset.size();
+        for (auto const &chunk : table)
+        {
+            if (chunk.offset.size() != dimensionality ||
+                chunk.extent.size() != dimensionality)
+            {
+                throw std::runtime_error(
+                    "[mergeChunks] Chunks must have equal dimensionality.");
+            }
+        }
+
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (size_t dim = dimensionality; dim-- > 0;)
+            {
+                std::sort(
+                    table.begin(),
+                    table.end(),
+                    [dim](auto const &left, auto const &right) {
+                        return lessForMerging(left, right, dim);
+                    });
+                ChunkTable result;
+                result.reserve(table.size());
+                for (auto &chunk : table)
+                {
+                    if (!result.empty() &&
+                        mergeableAlong(result.back(), chunk, dim))
+                    {
+                        auto &into = result.back();
+                        into.extent[dim] += chunk.extent[dim];
+                        if (into.valueBounds.has_value() &&
+                            chunk.valueBounds.has_value())
+                        {
+                            into.valueBounds->first = std::min(
+                                into.valueBounds->first,
+                                chunk.valueBounds->first);
+                            into.valueBounds->second = std::max(
+                                into.valueBounds->second,
+                                chunk.valueBounds->second);
+                        }
+                        else
+                        {
+                            into.valueBounds.reset();
+                        }
+                        merged = true;
+                    }
+                    else
+                    {
+                        result.push_back(std::move(chunk));
+                    }
+                }
+                table = std::move(result);
+            }
+        }
+
+        std::sort(
+            table.begin(),
+            table.end(),
+            [](auto const &left, auto const &right) {
+                if (left.offset != right.offset)
+                {
+                    return left.offset < right.offset;
+                }
+                return left.sourceID < right.sourceID;
+            });
+    }
+
+    PartialAssignment::PartialAssignment(ChunkTable notAssigned_in)
+        : notAssigned(std::move(notAssigned_in))
+    {}
+
+    PartialAssignment::PartialAssignment(
+        ChunkTable notAssigned_in, Assignment assigned_in)
+        : notAssigned(std::move(notAssigned_in))
+        , assigned(std::move(assigned_in))
+    {}
+
+    Assignment Strategy::assign(
+        ChunkTable table,
+        RankMeta const &rankMetaIn,
+        RankMeta const &rankMetaOut)
+    {
+        return assign(
+            PartialAssignment(std::move(table)), rankMetaIn, rankMetaOut);
+    }
+
+    PartialAssignment PartialStrategy::assign(
+        ChunkTable table,
+        RankMeta const &rankMetaIn,
+        RankMeta const &rankMetaOut)
+    {
+        return assign(
+            PartialAssignment(std::move(table)), rankMetaIn, rankMetaOut);
+    }
+
+    FromPartialStrategy::FromPartialStrategy(
+        std::unique_ptr<PartialStrategy> firstPass,
+        std::unique_ptr<Strategy> secondPass)
+        : m_firstPass(std::move(firstPass)), m_secondPass(std::move(secondPass))
+    {}
+
+    Assignment FromPartialStrategy::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &rankMetaIn,
+        RankMeta const &rankMetaOut)
+    {
+        return m_secondPass->assign(
+            m_firstPass->assign(
+                std::move(partialAssignment), rankMetaIn, rankMetaOut),
+            rankMetaIn,
+            rankMetaOut);
+    }
+
+    std::unique_ptr<Strategy> FromPartialStrategy::clone() const
+    {
+        return std::make_unique<FromPartialStrategy>(
+            m_firstPass->clone(), m_secondPass->clone());
+    }
+
+    Assignment RoundRobin::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &,
+        RankMeta const &rankMetaOut)
+    {
+        verifyReadingRanks(rankMetaOut, "RoundRobin");
+        auto &res = partialAssignment.assigned;
+        auto reader = rankMetaOut.begin();
+        for (auto &chunk : partialAssignment.notAssigned)
+        {
+            res[reader->first].push_back(std::move(chunk));
+            if (++reader == rankMetaOut.end())
+            {
+                reader = rankMetaOut.begin();
+            }
+        }
+        return std::move(res);
+    }
+
+    std::unique_ptr<Strategy> RoundRobin::clone() const
+    {
+        return std::make_unique<RoundRobin>(*this);
+    }
+
+    ByHostname::ByHostname(std::unique_ptr<Strategy> withinNode)
+        : m_withinNode(std::move(withinNode))
+    {}
+
+    PartialAssignment ByHostname::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &rankMetaIn,
+        RankMeta const &rankMetaOut)
+    {
+        std::map<std::string, RankMeta> readersByHost;
+        for (auto const &[rank, host] : rankMetaOut)
+        {
+            readersByHost[host][rank] = host;
+        }
+
+        std::map<std::string, ChunkTable> chunksByHost;
+        ChunkTable leftOver;
+        for (auto &chunk : partialAssignment.notAssigned)
+        {
+            auto writer = rankMetaIn.find(chunk.sourceID);
+            if (writer == rankMetaIn.end() ||
+                readersByHost.find(writer->second) == readersByHost.end())
+            {
+                leftOver.push_back(std::move(chunk));
+            }
+            else
+            {
+                chunksByHost[writer->second].push_back(std::move(chunk));
+            }
+        }
+
+        for (auto &[host, chunks] : chunksByHost)
+        {
+            appendAssignment(
+                partialAssignment.assigned,
+                m_withinNode->assign(
+                    PartialAssignment(std::move(chunks)),
+                    rankMetaIn,
+                    readersByHost.at(host)));
+        }
+        partialAssignment.notAssigned = std::move(leftOver);
+        return partialAssignment;
+    }
+
+    std::unique_ptr<PartialStrategy> ByHostname::clone() const
+    {
+        return std::make_unique<ByHostname>(m_withinNode->clone());
+    }
+
+    BinPacking::BinPacking(size_t splitAlongDimension_in)
+        : splitAlongDimension(splitAlongDimension_in)
+    {}
+
+    Assignment BinPacking::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &,
+        RankMeta const &rankMetaOut)
+    {
+        verifyReadingRanks(rankMetaOut, "BinPacking");
+
+        Extent::value_type totalVolume = 0;
+        for (auto const &chunk : partialAssignment.notAssigned)
+        {
+            totalVolume += volume(chunk);
+        }
+        Extent::value_type const idealVolume = std::max<Extent::value_type>(
+            1,
+            (totalVolume + rankMetaOut.size() - 1) / rankMetaOut.size());
+
+        // largest chunks first, ties resolved deterministically
+        auto &chunks = partialAssignment.notAssigned;
+        std::sort(
+            chunks.begin(),
+            chunks.end(),
+            [](WrittenChunkInfo const &left, WrittenChunkInfo const &right) {
+                auto const leftVolume = volume(left);
+                auto const rightVolume = volume(right);
+                if (leftVolume != rightVolume)
+                {
+                    return leftVolume > rightVolume;
+                }
+                if (left.sourceID != right.sourceID)
+                {
+                    return left.sourceID < right.sourceID;
+                }
+                return left.offset < right.offset;
+            });
+
+        auto &res = partialAssignment.assigned;
+        // (rank, load) per reading rank, filled up one after another
+        std::vector<std::pair<unsigned int, Extent::value_type>> bins;
+        for (auto const &reader : rankMetaOut)
+        {
+            Extent::value_type load = 0;
+            if (auto assigned = res.find(reader.first); assigned != res.end())
+            {
+                for (auto const &chunk : assigned->second)
+                {
+                    load += volume(chunk);
+                }
+            }
+            bins.emplace_back(reader.first, load);
+        }
+        auto assignTo = [&](size_t bin, WrittenChunkInfo piece) {
+            bins[bin].second += volume(piece);
+            res[bins[bin].first].push_back(std::move(piece));
+        };
+
+        size_t currentBin = 0;
+        auto const dim = splitAlongDimension;
+        for (auto &chunk : chunks)
+        {
+            for (;;)
+            {
+                // the last bin takes whatever remains
+                if (currentBin + 1 == bins.size())
+                {
+                    assignTo(currentBin, std::move(chunk));
+                    break;
+                }
+                auto const load = bins[currentBin].second;
+                auto const capacity =
+                    idealVolume > load ? idealVolume - load : 0;
+                auto const chunkVolume = volume(chunk);
+                if (chunkVolume <= capacity)
+                {
+                    assignTo(currentBin, std::move(chunk));
+                    break;
+                }
+                // split off as many slices along dim as still fit
+                if (dim < chunk.extent.size() && chunk.extent[dim] > 1)
+                {
+                    auto const sliceVolume = chunkVolume / chunk.extent[dim];
+                    auto const fittingSlices = capacity / sliceVolume;
+                    if (fittingSlices > 0)
+                    {
+                        WrittenChunkInfo piece = chunk;
+                        piece.extent[dim] = fittingSlices;
+                        chunk.offset[dim] += fittingSlices;
+                        chunk.extent[dim] -= fittingSlices;
+                        assignTo(currentBin, std::move(piece));
+                    }
+                }
+                ++currentBin;
+            }
+        }
+        return std::move(res);
+    }
+
+    std::unique_ptr<Strategy> BinPacking::clone() const
+    {
+        return std::make_unique<BinPacking>(*this);
+    }
+
+    OneDimensionalBlockSlicer::OneDimensionalBlockSlicer(
+        Extent::value_type dim)
+        : m_dim(dim)
+    {}
+
+    std::pair<Offset, Extent> OneDimensionalBlockSlicer::sliceBlock(
+        Extent const &totalExtent, size_t size, size_t rank)
+    {
+        if (m_dim >= totalExtent.size())
+        {
+            throw std::runtime_error(
+                "[OneDimensionalBlockSlicer] Dimension to slice along is out "
+                "of range.");
+        }
+        Offset offset(totalExtent.size(), 0);
+        Extent extent = totalExtent;
+        // the first `remainder` ranks get one additional slice
+        auto const base = totalExtent[m_dim] / size;
+        auto const remainder = totalExtent[m_dim] % size;
+        offset[m_dim] =
+            rank * base + std::min<Extent::value_type>(rank, remainder);
+        extent[m_dim] = base + (rank < remainder ? 1 : 0);
+        return {std::move(offset), std::move(extent)};
+    }
+
+    std::unique_ptr<BlockSlicer> OneDimensionalBlockSlicer::clone() const
+    {
+        return std::make_unique<OneDimensionalBlockSlicer>(*this);
+    }
+
+    ByCuboidSlice::ByCuboidSlice(
+        std::unique_ptr<BlockSlicer> blockSlicer, Extent totalExtent)
+        : m_blockSlicer(std::move(blockSlicer))
+        , m_totalExtent(std::move(totalExtent))
+    {}
+
+    Assignment ByCuboidSlice::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &,
+        RankMeta const &rankMetaOut)
+    {
+        verifyReadingRanks(rankMetaOut, "ByCuboidSlice");
+        auto &res = partialAssignment.assigned;
+        size_t const dimensionality = m_totalExtent.size();
+        size_t blockIndex = 0;
+        for (auto const &reader : rankMetaOut)
+        {
+            auto const [blockOffset, blockExtent] = m_blockSlicer->sliceBlock(
+                m_totalExtent, rankMetaOut.size(), blockIndex++);
+            for (auto const &chunk : partialAssignment.notAssigned)
+            {
+                if (chunk.offset.size() != dimensionality)
+                {
+                    throw std::runtime_error(
+                        "[ByCuboidSlice] Chunk dimensionality does not match "
+                        "the dataset.");
+                }
+                WrittenChunkInfo intersection = chunk;
+                bool empty = false;
+                for (size_t d = 0; d < dimensionality; ++d)
+                {
+                    auto const begin =
+                        std::max(chunk.offset[d], blockOffset[d]);
+                    auto const end = std::min(
+                        chunk.offset[d] + chunk.extent[d],
+                        blockOffset[d] + blockExtent[d]);
+                    if (end <= begin)
+                    {
+                        empty = true;
+                        break;
+                    }
+                    intersection.offset[d] = begin;
+                    intersection.extent[d] = end - begin;
+                }
+                if (!empty)
+                {
+                    res[reader.first].push_back(std::move(intersection));
+                }
+            }
+        }
+        return std::move(res);
+    }
+
+    std::unique_ptr<Strategy> ByCuboidSlice::clone() const
+    {
+        return std::make_unique<ByCuboidSlice>(
+            m_blockSlicer->clone(), m_totalExtent);
+    }
+
+    Assignment FailingStrategy::assign(
+        PartialAssignment partialAssignment, RankMeta const &, RankMeta const &)
+    {
+        if (!partialAssignment.notAssigned.empty())
+        {
+            throw std::runtime_error(
+                "[FailingStrategy] There are unassigned chunks!");
+        }
+        return std::move(partialAssignment.assigned);
+    }
+
+    std::unique_ptr<Strategy> FailingStrategy::clone() const
+    {
+        return std::make_unique<FailingStrategy>(*this);
+    }
+} // namespace chunk_assignment
+
 namespace host_info
 {
     constexpr size_t MAX_HOSTNAME_LENGTH = 256;
@@ -26,7 +26,10 @@
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
+#include <unordered_set>
 
 #if openPMD_USE_VERIFY
 #define VERIFY(CONDITION, TEXT)                                                \
@@ -498,6 +501,13 @@ void ADIOS2File::configure_IO()
     // set engine parameters
     std::set<std::string> alreadyConfigured;
     bool wasTheFlushTargetSpecifiedViaJSON = false;
+    /*
+     * Number of threads used by the BP5 engine for reading (and
+     * decompressing) the data of all Get() calls queued until
+     * PerformGets().
+     */
+    unsigned readThreads = static_cast<unsigned>(
+        std::max(0, auxiliary::getEnvNum("OPENPMD_ADIOS2_READ_THREADS", 0)));
     auto engineConfig = m_impl->config(adios_defaults::str_engine);
     if (!engineConfig.json().is_null())
     {
@@ -548,6 +558,29 @@ void ADIOS2File::configure_IO()
                 adios_defs::flushTargetFromString(target.value());
             wasTheFlushTargetSpecifiedViaJSON = true;
         }
+
+        if (engineConfig.json().contains(adios_defaults::str_readThreads))
+        {
+            auto const &threads =
+                engineConfig[adios_defaults::str_readThreads].json();
+            // TOML integers are signed
+            if (threads.is_number_integer() && threads.get<long long>() >= 0)
+            {
+                readThreads = threads.get<unsigned>();
+            }
+            else if (
+                json::asLowerCaseStringDynamic(threads).value_or("") ==
+                "auto")
+            {
+                readThreads = std::thread::hardware_concurrency();
+            }
+            else
+            {
+                throw error::BackendConfigSchema(
+                    {"adios2", "engine", adios_defaults::str_readThreads},
+                    "Must be either a non-negative integer or 'auto'.");
+            }
+        }
     }
 
     auto shadow = m_impl->m_config.invertShadow();
@@ -686,6 +719,16 @@ void ADIOS2File::configure_IO()
             auxiliary::getEnvNum("OPENPMD_ADIOS2_STATS_LEVEL", 0);
         m_IO.SetParameter("StatsLevel", std::to_string(stats_level));
     }
+    if (readThreads > 0 && readOnly(m_mode) &&
+        m_impl->realEngineType() == "bp5" && notYetConfigured("Threads"))
+    {
+        /*
+         * The BP5 engine distributes the queued reads over its threads
+         * in PerformGets(), so a single flush of many (compressed) chunks
+         * scales with the number of cores.
+         */
+        m_IO.SetParameter("Threads", std::to_string(readThreads));
+    }
     if (m_impl->realEngineType() == "sst" && notYetConfigured("QueueLimit"))
     {
         /*
@@ -1274,9 +1317,76 @@ ADIOS2File::availableVariablesPrefixed(std::string const &prefix)
         prefix, &ADIOS2File::availableVariables, *this);
 }
 
+static ADIOS2File::HierarchyIndex_t
+buildHierarchyIndex(ADIOS2File::AttributeMap_t const &names)
+{
+    ADIOS2File::HierarchyIndex_t res;
+    // levels already registered as sublevel of their parent level
+    std::unordered_set<std::string> registered;
+    for (auto const &pair : names)
+    {
+        auto const &name = pair.first;
+        auto slash = name.rfind('/');
+        std::string level =
+            slash == std::string::npos ? "" : name.substr(0, slash + 1);
+        res[level].leaves.push_back(
+            slash == std::string::npos ? name : name.substr(slash + 1));
+        // walk up until reaching an already known level
+        while (!level.empty() && registered.insert(level).second)
+        {
+            std::string withoutSlash = level.substr(0, level.size() - 1);
+            auto parentSlash = withoutSlash.rfind('/');
+            std::string parent = parentSlash == std::string::npos
+                ? ""
+                : withoutSlash.substr(0, parentSlash + 1);
+            std::string sublevel = parentSlash == std::string::npos
+                ? withoutSlash
+                : withoutSlash.substr(parentSlash + 1);
+            if (sublevel.empty())
+            {
+                break;
+            }
+            res[parent].sublevels.push_back(std::move(sublevel));
+            level = std::move(parent);
+        }
+    }
+    return res;
+}
+
+static ADIOS2File::HierarchyLevel const &lookupHierarchyLevel(
+    std::optional<ADIOS2File::HierarchyIndex_t> &index,
+    ADIOS2File::AttributeMap_t const &names,
+    std::string const &prefix)
+{
+    static ADIOS2File::HierarchyLevel const emptyLevel;
+    if (!index.has_value())
+    {
+        index = buildHierarchyIndex(names);
+    }
+    auto it =
+        index->find(auxiliary::ends_with(prefix, '/') ? prefix : prefix + '/');
+    return it == index->end() ? emptyLevel : it->second;
+}
+
+auto ADIOS2File::attributesAt(std::string const &prefix)
+    -> HierarchyLevel const &
+{
+    // make sure that the map is present before the index is consulted
+    auto const &attributes = availableAttributes();
+    return lookupHierarchyLevel(m_attributesIndex, attributes, prefix);
+}
+
+auto ADIOS2File::variablesAt(std::string const &prefix)
+    -> HierarchyLevel const &
+{
+    auto const &variables = availableVariables();
+    return lookupHierarchyLevel(m_variablesIndex, variables, prefix);
+}
+
 void ADIOS2File::invalidateAttributesMap()
 {
     m_availableAttributes = std::optional<AttributeMap_t>();
+    m_attributesIndex = std::optional<HierarchyIndex_t>();
 }
 
 ADIOS2File::AttributeMap_t const &ADIOS2File::availableAttributes()
@@ -1295,6 +1405,7 @@ ADIOS2File::AttributeMap_t const &ADIOS2File::availableAttributes()
 void ADIOS2File::invalidateVariablesMap()
 {
     m_availableVariables = std::optional<AttributeMap_t>();
+    m_variablesIndex = std::optional<HierarchyIndex_t>();
 }
 
 ADIOS2File::AttributeMap_t const &ADIOS2File::availableVariables()
@@ -543,7 +543,10 @@ ADIOS2IOHandlerImpl::flush(internal::ParsedFlushParams &flushParams)
             }
         }
 
-        if (auto shadow = adios2Config.invertShadow(); shadow.size() > 0)
+        if (auto shadow = flushParams.reportUnusedOptions
+                ? adios2Config.invertShadow()
+                : nlohmann::json::object();
+            shadow.size() > 0)
         {
             switch (adios2Config.originallySpecifiedAs)
             {
@@ -1227,6 +1230,95 @@ namespace detail
     }
 } // namespace detail
 
+namespace detail
+{
+    struct ReadSpan
+    {
+        template <typename T>
+        static void call(
+            ADIOS2IOHandlerImpl *impl,
+            Parameter<Operation::READ_BUFFER_VIEW> &params,
+            detail::ADIOS2File &ba,
+            std::string const &varName)
+        {
+            auto &IO = ba.m_IO;
+            auto &engine = ba.getEngine();
+            adios2::Variable<T> variable = impl->verifyDataset<T>(
+                params.offset, params.extent, IO, varName);
+            adios2::Dims offset(params.offset.begin(), params.offset.end());
+            adios2::Dims extent(params.extent.begin(), params.extent.end());
+            /*
+             * Only a selection that matches one written block exactly can be
+             * served from the engine's memory, anything else needs to be
+             * assembled into a user buffer.
+             */
+            auto blocksInfo =
+                engine.BlocksInfo<T>(variable, engine.CurrentStep());
+            for (auto &info : blocksInfo)
+            {
+                if (info.Start != offset || info.Count != extent)
+                {
+                    continue;
+                }
+                variable.SetBlockSelection(info.BlockID);
+                engine.Get(variable, info, adios2::Mode::Sync);
+                if (info.Data())
+                {
+                    params.out->ptr = info.Data();
+                    params.out->backendManagedBuffer = true;
+                }
+                return;
+            }
+        }
+
+        static constexpr char const *errorMsg = "ADIOS2: readBufferView()";
+    };
+} // namespace detail
+
+bool ADIOS2IOHandlerImpl::supportsReadBufferView() const
+{
+    /*
+     * Engines that hand out pointers into their own memory upon
+     * Engine::Get(Variable, Variable::Info) for reading.
+     * Other engines do not implement that overload and are served by the
+     * frontend fallback via READ_DATASET.
+     */
+    std::string optInEngines[] = {"inline"};
+    return std::any_of(
+        begin(optInEngines),
+        end(optInEngines),
+        [this](std::string const &engine) {
+            return engine == this->realEngineType();
+        });
+}
+
+void ADIOS2IOHandlerImpl::readBufferView(
+    Writable *writable, Parameter<Operation::READ_BUFFER_VIEW> &parameters)
+{
+    parameters.out->backendManagedBuffer = false;
+    if (!supportsReadBufferView())
+    {
+        return;
+    }
+    setAndGetFilePosition(writable);
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    detail::ADIOS2File &ba = getFileData(file, IfFileNotOpen::ThrowError);
+    ba.getEngine(); // make sure that a step is active if there is one
+    if (ba.m_mode != adios2::Mode::Read ||
+        ba.streamStatus != detail::ADIOS2File::StreamStatus::DuringStep)
+    {
+        return;
+    }
+    std::string name = nameOfVariable(writable);
+    if (switchAdios2VariableType<detail::HasOperators>(
+            parameters.dtype, name, ba.m_IO))
+    {
+        return;
+    }
+    switchAdios2VariableType<detail::ReadSpan>(
+        parameters.dtype, this, parameters, ba, name);
+}
+
 void ADIOS2IOHandlerImpl::readAttribute(
     Writable *writable, Parameter<Operation::READ_ATT> &parameters)
 {
@@ -1289,39 +1381,20 @@ void ADIOS2IOHandlerImpl::listPaths(
     switch (useGroupTable())
     {
     case UseGroupTable::No: {
-        std::vector<std::string> vars =
-            fileData.availableVariablesPrefixed(myName);
-        for (auto var : vars)
-        {
-            auto firstSlash = var.find_first_of('/');
-            if (firstSlash != std::string::npos)
-            {
-                var = var.substr(0, firstSlash);
-                subdirs.emplace(std::move(var));
-            }
-            else
-            { // var is a dataset at the current level
-                delete_me.push_back(std::move(var));
-            }
-        }
-        std::vector<std::string> attributes =
-            fileData.availableAttributesPrefixed(myName);
-        for (auto attr : attributes)
-        {
-            auto firstSlash = attr.find_first_of('/');
-            if (firstSlash != std::string::npos)
-            {
-                attr = attr.substr(0, firstSlash);
-                subdirs.emplace(std::move(attr));
-            }
-        }
+        auto const &vars = fileData.variablesAt(myName);
+        subdirs.insert(vars.sublevels.begin(), vars.sublevels.end());
+        // vars.leaves are datasets at the current level
+        delete_me = vars.leaves;
+        auto const &attributes = fileData.attributesAt(myName);
+        subdirs.insert(
+            attributes.sublevels.begin(), attributes.sublevels.end());
         break;
     }
     case UseGroupTable::Yes: {
         {
             auto tablePrefix = adios_defaults::str_activeTablePrefix + myName;
-            std::vector attrs =
-                fileData.availableAttributesPrefixed(tablePrefix);
+            // only groups directly below the current one
+            std::vector attrs = fileData.attributesAt(tablePrefix).leaves;
             if (fileData.streamStatus ==
                 detail::ADIOS2File::StreamStatus::DuringStep)
             {
@@ -1345,24 +1418,12 @@ void ADIOS2IOHandlerImpl::listPaths(
                         // group wasn't defined in current step
                         continue;
                     }
-                    auto firstSlash = attrName.find_first_of('/');
-                    if (firstSlash == std::string::npos)
-                    {
-                        subdirs.emplace(attrName);
-                    }
-                    // else // should we maybe consider deeper groups too?
+                    subdirs.emplace(attrName);
                 }
             }
             else
             {
-                for (auto const &attrName : attrs)
-                {
-                    auto firstSlash = attrName.find_first_of('/');
-                    if (firstSlash == std::string::npos)
-                    {
-                        subdirs.emplace(attrName);
-                    }
-                }
+                subdirs.insert(attrs.begin(), attrs.end());
             }
         }
         break;
@@ -1402,20 +1463,8 @@ void ADIOS2IOHandlerImpl::listDatasets(
 
     auto &fileData = getFileData(file, IfFileNotOpen::ThrowError);
 
-    std::unordered_set<std::string> subdirs;
-    for (auto var : fileData.availableVariablesPrefixed(myName))
-    {
-        // if string still contains a slash, variable is a dataset below the
-        // current group
-        // we only want datasets contained directly within the current group
-        // let's ensure that
-        auto firstSlash = var.find_first_of('/');
-        if (firstSlash == std::string::npos)
-        {
-            subdirs.emplace(std::move(var));
-        }
-    }
-    for (auto &dataset : subdirs)
+    // we only want datasets contained directly within the current group
+    for (auto const &dataset : fileData.variablesAt(myName).leaves)
     {
         parameters.datasets->emplace_back(dataset);
     }
@@ -1437,16 +1486,9 @@ void ADIOS2IOHandlerImpl::listAttributes(
     }
     auto &ba = getFileData(file, IfFileNotOpen::ThrowError);
 
-    std::vector<std::string> attrs =
-        ba.availableAttributesPrefixed(attributePrefix);
-
-    for (auto &rawAttr : attrs)
+    for (auto const &attr : ba.attributesAt(attributePrefix).leaves)
     {
-        auto attr = auxiliary::removeSlashes(rawAttr);
-        if (attr.find_last_of('/') == std::string::npos)
-        {
-            parameters.attributes->push_back(std::move(attr));
-        }
+        parameters.attributes->push_back(attr);
     }
 }
 
@@ -2108,6 +2150,21 @@ namespace detail
                 }
                 table.emplace_back(
                     std::move(offset), std::move(extent), info.WriterID);
+                if constexpr (
+                    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+                {
+                    /*
+                     * Without StatsLevel > 0 on the writing side, ADIOS2
+                     * reports zero bounds. Treating those as unknown only
+                     * costs reading a block that could have been skipped.
+                     */
+                    if (info.Min != T{} || info.Max != T{})
+                    {
+                        table.back().valueBounds = std::make_pair(
+                            static_cast<double>(info.Min),
+                            static_cast<double>(info.Max));
+                    }
+                }
             }
         };
         if (allSteps)
@@ -2180,6 +2237,11 @@ ADIOS2IOHandler::flush(internal::ParsedFlushParams &flushParams)
     return m_impl.flush(flushParams);
 }
 
+bool ADIOS2IOHandler::supportsReadBufferView() const
+{
+    return m_impl.supportsReadBufferView();
+}
+
 #else // openPMD_HAVE_ADIOS2
 
 #if openPMD_HAVE_MPI
@@ -2215,6 +2277,11 @@ std::future<void> ADIOS2IOHandler::flush(internal::ParsedFlushParams &)
     return std::future<void>();
 }
 
+bool ADIOS2IOHandler::supportsReadBufferView() const
+{
+    return false;
+}
+
 #endif
 
 } // namespace openPMD
@@ -22,11 +22,479 @@
 #include "openPMD/IO/AbstractIOHandler.hpp"
 
 #include "openPMD/IO/FlushParametersInternal.hpp"
+#include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
 
 namespace openPMD
 {
+namespace internal
+{
+    /*
+     * A single IO thread executing flushes one at a time, in submission
+     * order.
+     * IO tasks must be executed in order, so there is no use in running more
+     * than one flush concurrently. The frontend waits for all submitted
+     * flushes before touching the IO queue again.
+     */
+    class AsyncFlushWorker
+    {
+    public:
+        AsyncFlushWorker() : m_thread([this]() { this->run(); })
+        {}
+
+        ~AsyncFlushWorker()
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_shutdown = true;
+            }
+            m_wakeup.notify_all();
+            m_thread.join();
+        }
+
+        AsyncFlushWorker(AsyncFlushWorker const &) = delete;
+        AsyncFlushWorker &operator=(AsyncFlushWorker const &) = delete;
+
+        /*
+         * Jobs submitted while another one is still pending run after it.
+         * Since jobs work on the shared IO queue, only jobs that do not
+         * depend on its contents may be submitted in that situation.
+         */
+        std::future<void> submit(std::function<void()> job)
+        {
+            std::promise<void> promise;
+            auto res = promise.get_future();
+            {
+                std::unique_lock lock(m_mutex);
+                m_jobs.emplace_back(std::move(job), std::move(promise));
+            }
+            m_wakeup.notify_all();
+            return res;
+        }
+
+        bool busy()
+        {
+            std::unique_lock lock(m_mutex);
+            return !m_jobs.empty();
+        }
+
+        void await()
+        {
+            std::exception_ptr error;
+            {
+                std::unique_lock lock(m_mutex);
+                m_done.wait(lock, [this]() { return m_jobs.empty(); });
+                std::swap(error, m_error);
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock lock(m_mutex);
+            while (true)
+            {
+                m_wakeup.wait(
+                    lock, [this]() { return !m_jobs.empty() || m_shutdown; });
+                if (m_jobs.empty())
+                {
+                    return;
+                }
+                auto &[job, promise] = m_jobs.front();
+                std::exception_ptr previousError = m_error;
+                lock.unlock();
+                std::exception_ptr error;
+                if (!previousError)
+                {
+                    try
+                    {
+                        job();
+                        promise.set_value();
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                        promise.set_exception(error);
+                    }
+                }
+                else
+                {
+                    // skip jobs queued after a failed one
+                    promise.set_exception(previousError);
+                }
+                lock.lock();
+                if (error)
+                {
+                    m_error = std::move(error);
+                }
+                m_jobs.pop_front();
+                if (m_jobs.empty())
+                {
+                    m_done.notify_all();
+                }
+            }
+        }
+
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+        std::condition_variable m_done;
+        std::deque<std::pair<std::function<void()>, std::promise<void>>> m_jobs;
+        std::exception_ptr m_error;
+        bool m_shutdown = false;
+        // declared last, so all other members are initialized when it starts
+        std::thread m_thread;
+    };
+
+    namespace
+    {
+        bool isMetadataRead(Operation operation)
+        {
+            switch (operation)
+            {
+            case Operation::LIST_PATHS:
+            case Operation::LIST_DATASETS:
+            case Operation::LIST_ATTS:
+            case Operation::READ_ATT:
+                return true;
+            default:
+                return false;
+            }
+        }
+    } // namespace
+
+    std::optional<std::pair<std::string, std::string>>
+    MetadataCache::locateInIteration(Writable const *writable)
+    {
+        std::vector<std::string const *> keys;
+        for (; writable && writable->parent; writable = writable->parent)
+        {
+            auto const &key = writable->ownKeyWithinParent.str();
+            if (key.empty())
+            {
+                return std::nullopt;
+            }
+            keys.push_back(&key);
+        }
+        // Series -> iterations -> Iteration, keys are in reverse order
+        if (keys.size() < 2 || *keys.back() != "iterations")
+        {
+            return std::nullopt;
+        }
+        std::string path;
+        for (size_t i = keys.size() - 2; i-- > 0;)
+        {
+            if (!path.empty())
+            {
+                path += '/';
+            }
+            path += *keys[i];
+        }
+        return std::make_pair(*keys[keys.size() - 2], std::move(path));
+    }
+
+    bool MetadataCache::serve(IOTask const &task)
+    {
+        if (!isMetadataRead(task.operation))
+        {
+            return false;
+        }
+        auto location = locateInIteration(task.writable);
+        if (!location.has_value())
+        {
+            return false;
+        }
+        auto iteration = iterations.find(location->first);
+        if (iteration == iterations.end())
+        {
+            return false;
+        }
+        auto &cached = iteration->second;
+        using State = CachedIteration::State;
+        if (cached.state == State::Unchecked)
+        {
+            // one check per file, upon first use
+            auto status =
+                auxiliary::file_status(directory + cached.filename);
+            if (status.has_value() && status->size == cached.size &&
+                status->modificationTime == cached.modificationTime)
+            {
+                cached.state = State::Valid;
+            }
+            else
+            {
+                cached.objects.clear();
+                cached.state = State::Recording;
+                changed = true;
+            }
+        }
+        auto object = cached.objects.find(location->second);
+        if (object == cached.objects.end())
+        {
+            return false;
+        }
+        auto &cachedObject = object->second;
+
+        auto serveList = [](auto const &cachedList, auto &output) {
+            if (!cachedList.has_value())
+            {
+                return false;
+            }
+            *output = *cachedList;
+            return true;
+        };
+        switch (task.operation)
+        {
+            using O = Operation;
+        case O::LIST_PATHS:
+            return serveList(
+                cachedObject.paths,
+                static_cast<Parameter<O::LIST_PATHS> &>(*task.parameter)
+                    .paths);
+        case O::LIST_DATASETS:
+            return serveList(
+                cachedObject.datasets,
+                static_cast<Parameter<O::LIST_DATASETS> &>(*task.parameter)
+                    .datasets);
+        case O::LIST_ATTS:
+            return serveList(
+                cachedObject.attributeNames,
+                static_cast<Parameter<O::LIST_ATTS> &>(*task.parameter)
+                    .attributes);
+        case O::READ_ATT: {
+            auto &parameter =
+                static_cast<Parameter<O::READ_ATT> &>(*task.parameter);
+            auto attribute = cachedObject.attributes.find(parameter.name);
+            if (attribute == cachedObject.attributes.end())
+            {
+                return false;
+            }
+            *parameter.dtype = attribute->second.first;
+            *parameter.resource = attribute->second.second;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    void MetadataCache::record(IOTask const &task)
+    {
+        if (!isMetadataRead(task.operation))
+        {
+            return;
+        }
+        auto location = locateInIteration(task.writable);
+        if (!location.has_value())
+        {
+            return;
+        }
+        auto &cached = iterations[location->first];
+        if (cached.state == CachedIteration::State::Unchecked)
+        {
+            cached.objects.clear();
+            cached.state = CachedIteration::State::Recording;
+        }
+        auto &cachedObject = cached.objects[location->second];
+
+        auto recordList = [this](auto &cachedList, auto const &output) {
+            if (!cachedList.has_value())
+            {
+                cachedList = *output;
+                changed = true;
+            }
+        };
+        switch (task.operation)
+        {
+            using O = Operation;
+        case O::LIST_PATHS:
+            recordList(
+                cachedObject.paths,
+                static_cast<Parameter<O::LIST_PATHS> &>(*task.parameter)
+                    .paths);
+            break;
+        case O::LIST_DATASETS:
+            recordList(
+                cachedObject.datasets,
+                static_cast<Parameter<O::LIST_DATASETS> &>(*task.parameter)
+                    .datasets);
+            break;
+        case O::LIST_ATTS:
+            recordList(
+                cachedObject.attributeNames,
+                static_cast<Parameter<O::LIST_ATTS> &>(*task.parameter)
+                    .attributes);
+            break;
+        case O::READ_ATT: {
+            auto &parameter =
+                static_cast<Parameter<O::READ_ATT> &>(*task.parameter);
+            if (isCacheable(*parameter.dtype) &&
+                cachedObject.attributes
+                    .emplace(
+                        parameter.name,
+                        std::make_pair(*parameter.dtype, *parameter.resource))
+                    .second)
+            {
+                changed = true;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    bool MetadataCache::isCacheable(Datatype dtype)
+    {
+        switch (dtype)
+        {
+        case Datatype::LONG_DOUBLE:
+        case Datatype::CFLOAT:
+        case Datatype::CDOUBLE:
+        case Datatype::CLONG_DOUBLE:
+        case Datatype::VEC_LONG_DOUBLE:
+        case Datatype::VEC_CFLOAT:
+        case Datatype::VEC_CDOUBLE:
+        case Datatype::VEC_CLONG_DOUBLE:
+        case Datatype::UNDEFINED:
+            return false;
+        default:
+            return true;
+        }
+    }
+} // namespace internal
+
+void AbstractIOHandler::enableAsyncFlush()
+{
+    if (!m_asyncFlushWorker)
+    {
+        m_asyncFlushWorker = std::make_shared<internal::AsyncFlushWorker>();
+    }
+}
+
+void AbstractIOHandler::awaitPendingFlush()
+{
+    if (!m_asyncFlushWorker)
+    {
+        return;
+    }
+    try
+    {
+        m_asyncFlushWorker->await();
+    }
+    catch (...)
+    {
+        m_lastFlushSuccessful = false;
+        throw;
+    }
+}
+
+bool AbstractIOHandler::canFlushAsynchronously(
+    internal::FlushParams const &params) const
+{
+    if (params.flushLevel != FlushLevel::UserFlush || m_work.empty())
+    {
+        return false;
+    }
+    /*
+     * std::queue does not support iteration, but the underlying container
+     * does. Only tasks whose results are not inspected by the frontend
+     * directly after flushing may go to the background thread.
+     */
+    struct InspectQueue : std::queue<IOTask>
+    {
+        static bool onlyOutputTasks(std::queue<IOTask> const &queue)
+        {
+            auto const &tasks = queue.*(&InspectQueue::c);
+            for (auto const &task : tasks)
+            {
+                switch (task.operation)
+                {
+                    using O = Operation;
+                case O::CREATE_FILE:
+                case O::CLOSE_FILE:
+                case O::DELETE_FILE:
+                case O::CREATE_PATH:
+                case O::CLOSE_PATH:
+                case O::OPEN_PATH:
+                case O::DELETE_PATH:
+                case O::CREATE_DATASET:
+                case O::EXTEND_DATASET:
+                case O::DELETE_DATASET:
+                case O::WRITE_DATASET:
+                case O::DELETE_ATT:
+                case O::WRITE_ATT:
+                case O::DEREGISTER:
+                case O::TOUCH:
+                case O::SET_WRITTEN:
+                    break;
+                case O::CHECK_FILE:
+                case O::OPEN_FILE:
+                case O::LIST_PATHS:
+                case O::OPEN_DATASET:
+                case O::READ_DATASET:
+                case O::LIST_DATASETS:
+                case O::GET_BUFFER_VIEW:
+                case O::READ_BUFFER_VIEW:
+                case O::READ_ATT:
+                case O::LIST_ATTS:
+                case O::ADVANCE:
+                case O::AVAILABLE_CHUNKS:
+                case O::PREFETCH_FILES:
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+    return InspectQueue::onlyOutputTasks(m_work);
+}
+
 std::future<void> AbstractIOHandler::flush(internal::FlushParams const &params)
 {
+    auto submit = [this, &params]() {
+        // parse on the calling thread, so that errors in the configuration
+        // are reported directly
+        auto parsedParams =
+            std::make_shared<internal::ParsedFlushParams>(params);
+        m_lastFlushSuccessful = true;
+        return m_asyncFlushWorker->submit([this, parsedParams]() {
+            this->flush(*parsedParams);
+            if (parsedParams->reportUnusedOptions)
+            {
+                json::warnGlobalUnusedOptions(parsedParams->backendConfig);
+            }
+        });
+    };
+    /*
+     * Series::flush() might flush the IO handler once more directly after
+     * handing off the actual work. Since enqueue() waits for running
+     * flushes, no tasks can have been added in between, so queue this behind
+     * the running flush instead of waiting for it. (m_work itself must not be
+     * inspected here, the IO thread is still working on it.)
+     */
+    if (m_asyncFlushWorker && params.flushLevel == FlushLevel::UserFlush &&
+        m_asyncFlushWorker->busy())
+    {
+        return submit();
+    }
+    awaitPendingFlush();
+    if (m_asyncFlushWorker && canFlushAsynchronously(params))
+    {
+        return submit();
+    }
+
     internal::ParsedFlushParams parsedParams{params};
     auto future = [this, &parsedParams]() {
         try
@@ -40,7 +508,10 @@ std::future<void> AbstractIOHandler::flush(internal::FlushParams const &params)
         }
     }();
     m_lastFlushSuccessful = true;
-    json::warnGlobalUnusedOptions(parsedParams.backendConfig);
+    if (parsedParams.reportUnusedOptions)
+    {
+        json::warnGlobalUnusedOptions(parsedParams.backendConfig);
+    }
     return future;
 }
 } // namespace openPMD
@@ -331,6 +331,19 @@ std::future<void> AbstractIOHandlerImpl::flush()
                 getBufferView(i.writable, parameter);
                 break;
             }
+            case O::READ_BUFFER_VIEW: {
+                auto &parameter =
+                    deref_dynamic_cast<Parameter<O::READ_BUFFER_VIEW>>(
+                        i.parameter.get());
+                writeToStderr(
+                    "[",
+                    i.writable->parent,
+                    "->",
+                    i.writable,
+                    "] READ_BUFFER_VIEW");
+                readBufferView(i.writable, parameter);
+                break;
+            }
             case O::READ_ATT: {
                 auto &parameter = deref_dynamic_cast<Parameter<O::READ_ATT>>(
                     i.parameter.get());
@@ -437,6 +450,20 @@ std::future<void> AbstractIOHandlerImpl::flush()
                 setWritten(i.writable, parameter);
                 break;
             }
+            case O::PREFETCH_FILES: {
+                auto &parameter =
+                    deref_dynamic_cast<Parameter<O::PREFETCH_FILES>>(
+                        i.parameter.get());
+                writeToStderr(
+                    "[",
+                    i.writable->parent,
+                    "->",
+                    i.writable,
+                    "] PREFETCH_FILES, #files=",
+                    parameter.names.size());
+                prefetchFiles(i.writable, parameter);
+                break;
+            }
             }
         }
         catch (...)
@@ -480,6 +507,10 @@ std::future<void> AbstractIOHandlerImpl::flush()
                 throw;
             }
         }
+        if (auto &cache = m_handler->m_metadataCache; cache)
+        {
+            cache->record(i);
+        }
         (*m_handler).m_work.pop();
     }
     return std::future<void>();
@@ -490,4 +521,8 @@ void AbstractIOHandlerImpl::setWritten(
 {
     w->written = param.target_status;
 }
+
+void AbstractIOHandlerImpl::prefetchFiles(
+    Writable *, Parameter<Operation::PREFETCH_FILES> const &)
+{}
 } // namespace openPMD
@@ -23,9 +23,30 @@
 
 namespace openPMD::internal
 {
+PreparedFlushConfig::PreparedFlushConfig(json::ParsedConfig parsed_in)
+    : parsed(std::move(parsed_in))
+{}
+
+namespace
+{
+    json::TracingJSON parseBackendConfig(FlushParams const &flushParams)
+    {
+        if (flushParams.preparedBackendConfig)
+        {
+            // copy, the backends may modify their view of the config
+            return json::TracingJSON(flushParams.preparedBackendConfig->parsed);
+        }
+        return json::TracingJSON(json::parseOptions(
+            flushParams.backendConfig, /* considerFiles = */ false));
+    }
+} // namespace
+
 ParsedFlushParams::ParsedFlushParams(FlushParams const &flushParams)
     : flushLevel(flushParams.flushLevel)
-    , backendConfig(json::parseOptions(
-          flushParams.backendConfig, /* considerFiles = */ false))
+    , backendConfig(parseBackendConfig(flushParams))
+    , reportUnusedOptions(
+          !flushParams.preparedBackendConfig ||
+          !flushParams.preparedBackendConfig->reportedUnusedOptions.exchange(
+              true))
 {}
 } // namespace openPMD::internal
@@ -290,8 +290,10 @@ hid_t openPMD::getH5DataSpace(Attribute const &att)
     }
 }
 
+size_t g_posCalls = 0;
 std::string openPMD::concrete_h5_file_position(Writable *w)
 {
+    ++g_posCalls;
     std::stack<Writable *> hierarchy;
     if (!w->abstractFilePosition)
         w = w->parent;
@@ -31,6 +31,7 @@
 #include <stdexcept>
 
 #if openPMD_HAVE_HDF5
+#include "openPMD/ChunkInfo_internal.hpp"
 #include "openPMD/Datatype.hpp"
 #include "openPMD/Error.hpp"
 #include "openPMD/IO/HDF5/HDF5Auxiliary.hpp"
@@ -44,12 +45,22 @@
 
 #include <H5FDmpio.h>
 #include <hdf5.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #endif
 
+#include <algorithm>
 #include <complex>
 #include <cstring>
 #include <future>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <queue>
 #include <stack>
 #include <string>
 #include <typeinfo>
@@ -177,6 +188,31 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
             json::merge(m_config.getShadow(), init_json_shadow);
         }
 
+        if (m_config.json().contains("dataset_handle_cache_size"))
+        {
+            auto const &cacheSize =
+                m_config["dataset_handle_cache_size"].json();
+            if (!cacheSize.is_number_integer() ||
+                cacheSize.get<long long>() < 0)
+            {
+                throw error::BackendConfigSchema(
+                    {"hdf5", "dataset_handle_cache_size"},
+                    "Must be a non-negative integer.");
+            }
+            m_datasetHandleCacheSize = cacheSize.get<size_t>();
+        }
+
+        if (m_config.json().contains("mmap"))
+        {
+            auto const &mmap = m_config["mmap"].json();
+            if (!mmap.is_boolean())
+            {
+                throw error::BackendConfigSchema(
+                    {"hdf5", "mmap"}, "Must be of type boolean.");
+            }
+            m_useMmap = mmap.get<bool>();
+        }
+
         // unused params
         if (do_warn_unused_params)
         {
@@ -216,6 +252,9 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
 
 HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
 {
+    invalidateDatasetHandles();
+    unmapFiles();
+
     herr_t status;
     status = H5Tclose(m_H5T_BOOL_ENUM);
     if (status < 0)
@@ -474,6 +513,8 @@ void HDF5IOHandlerImpl::createDataset(
             "ADIOS1", "Joined Arrays currently only supported in ADIOS2");
     }
 
+    invalidateDatasetHandle(writable);
+
     if (!writable->written)
     {
         /* Sanitize name */
@@ -836,6 +877,9 @@ void HDF5IOHandlerImpl::extendDataset(
         throw std::runtime_error(
             "[HDF5] Extending an unwritten Dataset is not possible.");
 
+    // the cached dataspace would keep the old extent
+    invalidateDatasetHandle(writable);
+
     auto res = getFile(writable);
     if (!res)
         res = getFile(writable->parent);
@@ -912,39 +956,95 @@ void HDF5IOHandlerImpl::availableChunks(
         "dataset "
         "during dataset read.");
 
-    // // now let's figure out whether this one has chunks
-    // hid_t propertyList = H5Dget_create_plist( dataset_id );
-    // std::vector< hsize_t > chunkExtent( ndims, 0 );
-    // int chunkDimensionality =
-    //     H5Pget_chunk( propertyList, ndims, chunkExtent.data() );
-
-    // if( chunkDimensionality >= 0 )
-    // {
-    //     /*
-    //      * so, the dataset indeed has chunks
-    //      * alas, this backend doesn't write chunks, so for now, reading them
-    //      * is unimplemented
-    //      *
-    //      * https://hdf5.io/develop/group___h5_d.html#gaccff213d3e0765b86f66d08dd9959807
-    //      * May or may not be helpful if implementing this properly one day.
-    //      */
-    // }
-
     std::vector<hsize_t> dims(ndims, 0);
     // return value is equal to ndims
     H5Sget_simple_extent_dims(dataset_space, dims.data(), nullptr);
 
-    Offset offset(ndims, 0);
-    Extent extent;
-    extent.reserve(ndims);
-    for (auto e : dims)
+    hid_t propertyList = H5Dget_create_plist(dataset_id);
+    VERIFY(
+        propertyList >= 0,
+        "[HDF5] Internal error: Failed to get HDF5 dataset creation property "
+        "list during availableChunks task");
+    bool reportedStorageChunks = false;
+#if H5_VERSION_GE(1, 10, 5)
+    if (ndims > 0 && H5Pget_layout(propertyList) == H5D_CHUNKED)
     {
-        extent.push_back(e);
+        /*
+         * Report the chunks that have actually been allocated in the file
+         * (unwritten regions are not allocated), clipped to the dataset
+         * extent, and merge neighboring ones so that readers see the written
+         * regions at storage-aligned boundaries.
+         * A dataset without any allocated chunks is reported as a whole
+         * below, as before, since it still reads as the fill value.
+         */
+        std::vector<hsize_t> chunkExtent(ndims, 0);
+        H5Pget_chunk(propertyList, ndims, chunkExtent.data());
+        hsize_t numChunks = 0;
+        herr_t status =
+            H5Dget_num_chunks(dataset_id, dataset_space, &numChunks);
+        VERIFY(
+            status >= 0,
+            "[HDF5] Internal error: Failed to get number of chunks during "
+            "availableChunks task");
+        std::vector<hsize_t> chunkOffset(ndims, 0);
+        ChunkTable table;
+        table.reserve(numChunks);
+        for (hsize_t i = 0; i < numChunks; ++i)
+        {
+            unsigned filterMask;
+            haddr_t address;
+            hsize_t storageSize;
+            status = H5Dget_chunk_info(
+                dataset_id,
+                dataset_space,
+                i,
+                chunkOffset.data(),
+                &filterMask,
+                &address,
+                &storageSize);
+            VERIFY(
+                status >= 0,
+                "[HDF5] Internal error: Failed to get chunk info during "
+                "availableChunks task");
+            Offset offset(chunkOffset.begin(), chunkOffset.end());
+            Extent extent;
+            extent.reserve(ndims);
+            for (int d = 0; d < ndims; ++d)
+            {
+                extent.push_back(
+                    std::min(chunkExtent[d], dims[d] - chunkOffset[d]));
+            }
+            table.emplace_back(std::move(offset), std::move(extent));
+        }
+        chunk_assignment::mergeChunks(table);
+        parameters.chunks->insert(
+            parameters.chunks->end(),
+            std::make_move_iterator(table.begin()),
+            std::make_move_iterator(table.end()));
+        reportedStorageChunks = numChunks > 0;
+    }
+#endif
+    if (!reportedStorageChunks)
+    {
+        // contiguous or compact storage or no allocated chunks,
+        // no finer structure to report
+        Offset offset(ndims, 0);
+        Extent extent;
+        extent.reserve(ndims);
+        for (auto e : dims)
+        {
+            extent.push_back(e);
+        }
+        parameters.chunks->push_back(
+            WrittenChunkInfo(std::move(offset), std::move(extent)));
     }
-    parameters.chunks->push_back(
-        WrittenChunkInfo(std::move(offset), std::move(extent)));
 
     herr_t status;
+    status = H5Pclose(propertyList);
+    VERIFY(
+        status == 0,
+        "[HDF5] Internal error: Failed to close HDF5 property list during "
+        "availableChunks task");
     status = H5Sclose(dataset_space);
     VERIFY(
         status == 0,
@@ -1022,6 +1122,8 @@ void HDF5IOHandlerImpl::closeFile(
             "present in the backend");
     }
     File file = optionalFile.value();
+    invalidateDatasetHandles(file.id);
+    unmapFile(file.id);
     H5Fclose(file.id);
     m_openFileIDs.erase(file.id);
     m_fileNames.erase(writable);
@@ -1119,6 +1221,8 @@ void HDF5IOHandlerImpl::openPath(
 void HDF5IOHandlerImpl::openDataset(
     Writable *writable, Parameter<Operation::OPEN_DATASET> &parameters)
 {
+    invalidateDatasetHandle(writable);
+
     File file = getFile(writable->parent).value();
     hid_t node_id, dataset_id;
 
@@ -1362,6 +1466,8 @@ void HDF5IOHandlerImpl::deleteFile(
     if (writable->written)
     {
         hid_t file_id = getFile(writable).value().id;
+        invalidateDatasetHandles(file_id);
+        unmapFile(file_id);
         herr_t status = H5Fclose(file_id);
         VERIFY(
             status == 0,
@@ -1409,6 +1515,7 @@ void HDF5IOHandlerImpl::deletePath(
          */
         auto res = getFile(writable);
         File file = res ? res.value() : getFile(writable->parent).value();
+        invalidateDatasetHandles(file.id);
         hid_t node_id = H5Gopen(
             file.id,
             concrete_h5_file_position(writable->parent).c_str(),
@@ -1461,6 +1568,7 @@ void HDF5IOHandlerImpl::deleteDataset(
          */
         auto res = getFile(writable);
         File file = res ? res.value() : getFile(writable->parent).value();
+        invalidateDatasetHandles(file.id);
         hid_t node_id = H5Gopen(
             file.id,
             concrete_h5_file_position(writable->parent).c_str(),
@@ -1536,56 +1644,8 @@ void HDF5IOHandlerImpl::writeDataset(
     auto res = getFile(writable);
     File file = res ? res.value() : getFile(writable->parent).value();
 
-    hid_t dataset_id, filespace, memspace;
-    herr_t status;
-    dataset_id = H5Dopen(
-        file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
-    VERIFY(
-        dataset_id >= 0,
-        "[HDF5] Internal error: Failed to open HDF5 dataset during dataset "
-        "write");
-
-    std::vector<hsize_t> start;
-    for (auto const &val : parameters.offset)
-        start.push_back(static_cast<hsize_t>(val));
-    std::vector<hsize_t> stride(start.size(), 1); /* contiguous region */
-    std::vector<hsize_t> count(start.size(), 1); /* single region */
-    std::vector<hsize_t> block;
-    for (auto const &val : parameters.extent)
-        block.push_back(static_cast<hsize_t>(val));
-    memspace =
-        H5Screate_simple(static_cast<int>(block.size()), block.data(), nullptr);
-    filespace = H5Dget_space(dataset_id);
-    status = H5Sselect_hyperslab(
-        filespace,
-        H5S_SELECT_SET,
-        start.data(),
-        stride.data(),
-        count.data(),
-        block.data());
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to select hyperslab during dataset "
-        "write");
-
-    void const *data = parameters.data.get();
-
-    GetH5DataType getH5DataType({
-        {typeid(bool).name(), m_H5T_BOOL_ENUM},
-        {typeid(std::complex<float>).name(), m_H5T_CFLOAT},
-        {typeid(std::complex<double>).name(), m_H5T_CDOUBLE},
-        {typeid(std::complex<long double>).name(), m_H5T_CLONG_DOUBLE},
-    });
-
     // TODO Check if parameter dtype and dataset dtype match
-    Attribute a(0);
-    a.dtype = parameters.dtype;
-    hid_t dataType = getH5DataType(a);
-    VERIFY(
-        dataType >= 0,
-        "[HDF5] Internal error: Failed to get HDF5 datatype during dataset "
-        "write");
-    switch (a.dtype)
+    switch (parameters.dtype)
     {
         using DT = Datatype;
     case DT::LONG_DOUBLE:
@@ -1606,45 +1666,266 @@ void HDF5IOHandlerImpl::writeDataset(
     case DT::UCHAR:
     case DT::SCHAR:
     case DT::BOOL:
-        status = H5Dwrite(
-            dataset_id,
-            dataType,
-            memspace,
-            filespace,
-            m_datasetTransferProperty,
-            data);
-        VERIFY(
-            status == 0,
-            "[HDF5] Internal error: Failed to write dataset " +
-                concrete_h5_file_position(writable));
         break;
     case DT::UNDEFINED:
         throw std::runtime_error("[HDF5] Undefined Attribute datatype");
     default:
         throw std::runtime_error("[HDF5] Datatype not implemented in HDF5 IO");
     }
-    status = H5Tclose(dataType);
+
+    if (auto it = m_coalescedWrites.find(&parameters);
+        it != m_coalescedWrites.end())
+    {
+        // keep the merged tasks alive until written
+        auto merged = std::move(it->second);
+        m_coalescedWrites.erase(it);
+        std::vector<Parameter<Operation::WRITE_DATASET> *> chunks;
+        chunks.reserve(merged.size() + 1);
+        chunks.push_back(&parameters);
+        for (auto const &param : merged)
+        {
+            chunks.push_back(
+                static_cast<Parameter<Operation::WRITE_DATASET> *>(
+                    param.get()));
+        }
+        writeDatasetCoalesced(writable, file, chunks);
+    }
+    else
+    {
+        writeDatasetChunk(writable, file, parameters);
+    }
+    trimDatasetHandles();
+
+    m_fileNames[writable] = file.name;
+}
+
+void HDF5IOHandlerImpl::writeDatasetChunk(
+    Writable *writable,
+    File const &file,
+    Parameter<Operation::WRITE_DATASET> const &parameters)
+{
+    auto &dataset = getDatasetHandle(writable, file);
+    hid_t memspace;
+    herr_t status;
+
+    std::vector<hsize_t> start;
+    for (auto const &val : parameters.offset)
+        start.push_back(static_cast<hsize_t>(val));
+    std::vector<hsize_t> stride(start.size(), 1); /* contiguous region */
+    std::vector<hsize_t> count(start.size(), 1); /* single region */
+    std::vector<hsize_t> block;
+    for (auto const &val : parameters.extent)
+        block.push_back(static_cast<hsize_t>(val));
+    memspace =
+        H5Screate_simple(static_cast<int>(block.size()), block.data(), nullptr);
+    status = H5Sselect_hyperslab(
+        dataset.dataspace,
+        H5S_SELECT_SET,
+        start.data(),
+        stride.data(),
+        count.data(),
+        block.data());
     VERIFY(
         status == 0,
-        "[HDF5] Internal error: Failed to close dataset datatype during "
-        "dataset write");
-    status = H5Sclose(filespace);
+        "[HDF5] Internal error: Failed to select hyperslab during dataset "
+        "write");
+
+    status = H5Dwrite(
+        dataset.dataset,
+        getDatasetMemoryType(dataset, parameters.dtype),
+        memspace,
+        dataset.dataspace,
+        m_datasetTransferProperty,
+        parameters.data.get());
     VERIFY(
         status == 0,
-        "[HDF5] Internal error: Failed to close dataset file space during "
-        "dataset write");
+        "[HDF5] Internal error: Failed to write dataset " +
+            concrete_h5_file_position(writable));
+
     status = H5Sclose(memspace);
     VERIFY(
         status == 0,
         "[HDF5] Internal error: Failed to close dataset memory space during "
         "dataset write");
-    status = H5Dclose(dataset_id);
+}
+
+void HDF5IOHandlerImpl::writeDatasetCoalesced(
+    Writable *writable,
+    File const &file,
+    std::vector<Parameter<Operation::WRITE_DATASET> *> const &chunks)
+{
+    auto numChunkElements = [](auto const &extent) {
+        hsize_t res = 1;
+        for (auto const &val : extent)
+        {
+            res *= static_cast<hsize_t>(val);
+        }
+        return res;
+    };
+    // empty chunks take part in a run, but have nothing to write
+    std::vector<Parameter<Operation::WRITE_DATASET> *> nonEmpty;
+    nonEmpty.reserve(chunks.size());
+    for (auto chunk : chunks)
+    {
+        if (numChunkElements(chunk->extent) > 0)
+        {
+            nonEmpty.push_back(chunk);
+        }
+    }
+    if (nonEmpty.empty())
+    {
+        return;
+    }
+
+    auto &dataset = getDatasetHandle(writable, file);
+    herr_t status;
+
+    status = H5Sselect_none(dataset.dataspace);
     VERIFY(
         status == 0,
-        "[HDF5] Internal error: Failed to close dataset " +
-            concrete_h5_file_position(writable) + " during dataset write");
+        "[HDF5] Internal error: Failed to reset selection during dataset "
+        "write");
+    hsize_t numElements = 0;
+    for (auto chunk : nonEmpty)
+    {
+        std::vector<hsize_t> start;
+        for (auto const &val : chunk->offset)
+            start.push_back(static_cast<hsize_t>(val));
+        std::vector<hsize_t> stride(start.size(), 1); /* contiguous region */
+        std::vector<hsize_t> count(start.size(), 1); /* single region */
+        std::vector<hsize_t> block;
+        for (auto const &val : chunk->extent)
+            block.push_back(static_cast<hsize_t>(val));
+        status = H5Sselect_hyperslab(
+            dataset.dataspace,
+            H5S_SELECT_OR,
+            start.data(),
+            stride.data(),
+            count.data(),
+            block.data());
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to select hyperslab during dataset "
+            "write");
+        numElements += numChunkElements(chunk->extent);
+    }
 
-    m_fileNames[writable] = file.name;
+    if (H5Sget_select_npoints(dataset.dataspace) !=
+        static_cast<hssize_t>(numElements))
+    {
+        // Overlapping chunks, the last write must win.
+        for (auto chunk : nonEmpty)
+        {
+            writeDatasetChunk(writable, file, *chunk);
+        }
+        return;
+    }
+
+    /*
+     * H5Dwrite maps the memory buffer onto the selected elements in the
+     * row-major order of the file dataspace, so gather the rows (along the
+     * fastest varying dimension) of all chunks in that order.
+     */
+    int ndims = H5Sget_simple_extent_ndims(dataset.dataspace);
+    VERIFY(
+        ndims > 0,
+        "[HDF5] Internal error: Failed to retrieve dimensionality of dataset "
+        "during dataset write");
+    std::vector<hsize_t> dims(ndims);
+    H5Sget_simple_extent_dims(dataset.dataspace, dims.data(), nullptr);
+    // number of elements that a step along each dimension skips in the file
+    std::vector<hsize_t> fileStride(ndims, 1);
+    for (int d = ndims - 2; d >= 0; --d)
+    {
+        fileStride[d] = fileStride[d + 1] * dims[d + 1];
+    }
+
+    struct Row
+    {
+        hsize_t fileIndex;
+        char const *data;
+        size_t bytes;
+        size_t chunk;
+    };
+    std::vector<Row> rows;
+    // rows of each chunk that still need to be gathered
+    std::vector<size_t> pendingRows(nonEmpty.size(), 0);
+    size_t const elementSize = toBytes(nonEmpty.front()->dtype);
+    for (size_t i = 0; i < nonEmpty.size(); ++i)
+    {
+        auto chunk = nonEmpty[i];
+        auto const &offset = chunk->offset;
+        auto const &extent = chunk->extent;
+        size_t const rowBytes = extent.back() * elementSize;
+        auto data = static_cast<char const *>(chunk->data.get());
+        // position within the chunk, excluding the fastest varying dimension
+        std::vector<hsize_t> index(ndims - 1, 0);
+        for (;;)
+        {
+            hsize_t fileIndex = offset.back();
+            for (int d = 0; d < ndims - 1; ++d)
+            {
+                fileIndex += (offset[d] + index[d]) * fileStride[d];
+            }
+            rows.push_back(Row{fileIndex, data, rowBytes, i});
+            ++pendingRows[i];
+            data += rowBytes;
+
+            int d = ndims - 2;
+            for (; d >= 0; --d)
+            {
+                if (++index[d] < extent[d])
+                {
+                    break;
+                }
+                index[d] = 0;
+            }
+            if (d < 0)
+            {
+                break;
+            }
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](Row const &l, Row const &r) {
+        return l.fileIndex < r.fileIndex;
+    });
+
+    /*
+     * Drop the reference to each source buffer as soon as all of its rows
+     * are gathered, so the gathered copy and the sources are not both kept
+     * alive until the write.
+     */
+    Datatype const dtype = nonEmpty.front()->dtype;
+    std::unique_ptr<char[]> gathered{new char[numElements * elementSize]};
+    char *dest = gathered.get();
+    for (auto const &row : rows)
+    {
+        std::memcpy(dest, row.data, row.bytes);
+        dest += row.bytes;
+        if (--pendingRows[row.chunk] == 0)
+        {
+            nonEmpty[row.chunk]->data = auxiliary::WriteBuffer();
+        }
+    }
+
+    hid_t memspace = H5Screate_simple(1, &numElements, nullptr);
+    status = H5Dwrite(
+        dataset.dataset,
+        getDatasetMemoryType(dataset, dtype),
+        memspace,
+        dataset.dataspace,
+        m_datasetTransferProperty,
+        gathered.get());
+    VERIFY(
+        status == 0,
+        "[HDF5] Internal error: Failed to write dataset " +
+            concrete_h5_file_position(writable));
+
+    status = H5Sclose(memspace);
+    VERIFY(
+        status == 0,
+        "[HDF5] Internal error: Failed to close dataset memory space during "
+        "dataset write");
 }
 
 void HDF5IOHandlerImpl::writeAttribute(
@@ -1957,19 +2238,75 @@ void HDF5IOHandlerImpl::writeAttribute(
     m_fileNames[writable] = file.name;
 }
 
+namespace
+{
+    /*
+     * Copy the hyperslab (offset, extent) out of a row-major array of the
+     * given dimensions into a contiguous buffer, one row at a time.
+     */
+    void copyHyperslab(
+        char const *src,
+        std::vector<hsize_t> const &dims,
+        std::vector<hsize_t> const &offset,
+        std::vector<hsize_t> const &extent,
+        size_t elementSize,
+        char *dest)
+    {
+        size_t const ndims = dims.size();
+        if (ndims == 0)
+        {
+            std::memcpy(dest, src, elementSize);
+            return;
+        }
+        if (std::find(extent.begin(), extent.end(), 0) != extent.end())
+        {
+            return;
+        }
+        std::vector<size_t> strides(ndims);
+        size_t stride = elementSize;
+        for (size_t i = ndims; i-- > 0;)
+        {
+            strides[i] = stride;
+            stride *= dims[i];
+        }
+        size_t const rowBytes = extent.back() * elementSize;
+        // index of the current row within the outer dimensions of extent
+        std::vector<hsize_t> index(ndims - 1, 0);
+        while (true)
+        {
+            size_t srcOffset = offset.back() * elementSize;
+            for (size_t i = 0; i + 1 < ndims; ++i)
+            {
+                srcOffset += (offset[i] + index[i]) * strides[i];
+            }
+            std::memcpy(dest, src + srcOffset, rowBytes);
+            dest += rowBytes;
+
+            size_t dim = ndims - 1;
+            for (; dim > 0; --dim)
+            {
+                if (++index[dim - 1] < extent[dim - 1])
+                {
+                    break;
+                }
+                index[dim - 1] = 0;
+            }
+            if (dim == 0)
+            {
+                return;
+            }
+        }
+    }
+} // namespace
+
 void HDF5IOHandlerImpl::readDataset(
     Writable *writable, Parameter<Operation::READ_DATASET> &parameters)
 {
     auto res = getFile(writable);
     File file = res ? res.value() : getFile(writable->parent).value();
-    hid_t dataset_id, memspace, filespace;
+    auto &dataset = getDatasetHandle(writable, file);
+    hid_t memspace;
     herr_t status;
-    dataset_id = H5Dopen(
-        file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
-    VERIFY(
-        dataset_id >= 0,
-        "[HDF5] Internal error: Failed to open HDF5 dataset during dataset "
-        "read");
 
     std::vector<hsize_t> start;
     for (auto const &val : parameters.offset)
@@ -1981,9 +2318,8 @@ void HDF5IOHandlerImpl::readDataset(
         block.push_back(static_cast<hsize_t>(val));
     memspace =
         H5Screate_simple(static_cast<int>(block.size()), block.data(), nullptr);
-    filespace = H5Dget_space(dataset_id);
     status = H5Sselect_hyperslab(
-        filespace,
+        dataset.dataspace,
         H5S_SELECT_SET,
         start.data(),
         stride.data(),
@@ -1996,9 +2332,7 @@ void HDF5IOHandlerImpl::readDataset(
 
     void *data = parameters.data.get();
 
-    Attribute a(0);
-    a.dtype = parameters.dtype;
-    switch (a.dtype)
+    switch (parameters.dtype)
     {
         using DT = Datatype;
     case DT::LONG_DOUBLE:
@@ -2026,77 +2360,102 @@ void HDF5IOHandlerImpl::readDataset(
     default:
         throw std::runtime_error("[HDF5] Datatype not implemented in HDF5 IO");
     }
-    GetH5DataType getH5DataType({
-        {typeid(bool).name(), m_H5T_BOOL_ENUM},
-        {typeid(std::complex<float>).name(), m_H5T_CFLOAT},
-        {typeid(std::complex<double>).name(), m_H5T_CDOUBLE},
-        {typeid(std::complex<long double>).name(), m_H5T_CLONG_DOUBLE},
-    });
-    hid_t dataType = getH5DataType(a);
-    if (H5Tequal(dataType, H5T_NATIVE_LDOUBLE))
+    if (char const *mapped =
+            getMappedDataset(dataset, file, parameters.dtype);
+        mapped)
     {
-        // We have previously determined in openDataset() that this dataset is
-        // of type long double.
-        // We cannot know if that actually was H5T_NATIVE_LDOUBLE or if it was
-        // the worked-around m_H5T_LONG_DOUBLE_80_LE.
-        // Check this.
-        hid_t checkDatasetTypeAgain = H5Dget_type(dataset_id);
-        if (!H5Tequal(checkDatasetTypeAgain, H5T_NATIVE_LDOUBLE))
-        {
-            dataType = m_H5T_LONG_DOUBLE_80_LE;
-        }
-        status = H5Tclose(checkDatasetTypeAgain);
-        VERIFY(
-            status == 0,
-            "[HDF5] Internal error: Failed to close HDF5 dataset type during "
-            "dataset reading");
+        std::vector<hsize_t> dims(block.size());
+        H5Sget_simple_extent_dims(dataset.dataspace, dims.data(), nullptr);
+        copyHyperslab(
+            mapped,
+            dims,
+            start,
+            block,
+            H5Tget_size(getDatasetMemoryType(dataset, parameters.dtype)),
+            static_cast<char *>(data));
     }
-    else if (H5Tequal(dataType, m_H5T_CLONG_DOUBLE))
+    else
     {
-        // Same deal for m_H5T_CLONG_DOUBLE
-        hid_t checkDatasetTypeAgain = H5Dget_type(dataset_id);
-        if (!H5Tequal(checkDatasetTypeAgain, m_H5T_CLONG_DOUBLE))
-        {
-            dataType = m_H5T_CLONG_DOUBLE_80_LE;
-        }
-        status = H5Tclose(checkDatasetTypeAgain);
-        VERIFY(
-            status == 0,
-            "[HDF5] Internal error: Failed to close HDF5 dataset type during "
-            "dataset reading");
+        status = H5Dread(
+            dataset.dataset,
+            getDatasetMemoryType(dataset, parameters.dtype),
+            memspace,
+            dataset.dataspace,
+            m_datasetTransferProperty,
+            data);
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to read dataset");
     }
-    VERIFY(
-        dataType >= 0,
-        "[HDF5] Internal error: Failed to get HDF5 datatype during dataset "
-        "read");
-    status = H5Dread(
-        dataset_id,
-        dataType,
-        memspace,
-        filespace,
-        m_datasetTransferProperty,
-        data);
-    VERIFY(status == 0, "[HDF5] Internal error: Failed to read dataset");
 
-    status = H5Tclose(dataType);
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to close dataset datatype during "
-        "dataset read");
-    status = H5Sclose(filespace);
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to close dataset file space during "
-        "dataset read");
     status = H5Sclose(memspace);
     VERIFY(
         status == 0,
         "[HDF5] Internal error: Failed to close dataset memory space during "
         "dataset read");
-    status = H5Dclose(dataset_id);
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to close dataset during dataset read");
+    trimDatasetHandles();
+}
+
+void HDF5IOHandlerImpl::readBufferView(
+    Writable *writable, Parameter<Operation::READ_BUFFER_VIEW> &parameters)
+{
+    parameters.out->backendManagedBuffer = false;
+    if (!m_useMmap)
+    {
+        return;
+    }
+    auto res = getFile(writable);
+    File file = res ? res.value() : getFile(writable->parent).value();
+    auto &dataset = getDatasetHandle(writable, file);
+    char const *mapped = getMappedDataset(dataset, file, parameters.dtype);
+    int ndims = H5Sget_simple_extent_ndims(dataset.dataspace);
+    if (!mapped || ndims < 0 ||
+        parameters.offset.size() != static_cast<size_t>(ndims) ||
+        parameters.extent.size() != static_cast<size_t>(ndims))
+    {
+        trimDatasetHandles();
+        return;
+    }
+    std::vector<hsize_t> dims(ndims);
+    H5Sget_simple_extent_dims(dataset.dataspace, dims.data(), nullptr);
+    for (int i = 0; i < ndims; ++i)
+    {
+        if (parameters.offset[i] + parameters.extent[i] > dims[i])
+        {
+            // let the fallback report the error
+            trimDatasetHandles();
+            return;
+        }
+    }
+
+    /*
+     * The selection is contiguous in the file if, behind its first
+     * dimension with an extent larger than one, it spans the full dataset.
+     */
+    int first = 0;
+    while (first + 1 < ndims && parameters.extent[first] == 1)
+    {
+        ++first;
+    }
+    for (int i = first + 1; i < ndims; ++i)
+    {
+        if (parameters.offset[i] != 0 || parameters.extent[i] != dims[i])
+        {
+            trimDatasetHandles();
+            return;
+        }
+    }
+
+    size_t const elementSize =
+        H5Tget_size(getDatasetMemoryType(dataset, parameters.dtype));
+    size_t byteOffset = 0;
+    size_t stride = elementSize;
+    for (int i = ndims; i-- > 0;)
+    {
+        byteOffset += parameters.offset[i] * stride;
+        stride *= dims[i];
+    }
+    parameters.out->ptr = mapped + byteOffset;
+    parameters.out->backendManagedBuffer = true;
+    trimDatasetHandles();
 }
 
 void HDF5IOHandlerImpl::readAttribute(
@@ -2914,6 +3273,7 @@ void HDF5IOHandlerImpl::listAttributes(
 void HDF5IOHandlerImpl::deregister(
     Writable *writable, Parameter<Operation::DEREGISTER> const &)
 {
+    invalidateDatasetHandle(writable);
     m_fileNames.erase(writable);
 }
 
@@ -2941,15 +3301,385 @@ HDF5IOHandlerImpl::getFile(Writable *writable)
     return std::make_optional(std::move(res));
 }
 
+auto HDF5IOHandlerImpl::getDatasetHandle(Writable *writable, File const &file)
+    -> DatasetHandle &
+{
+    if (auto it = m_datasetHandlesByWritable.find(writable);
+        it != m_datasetHandlesByWritable.end())
+    {
+        if (it->second->second.file == file.id)
+        {
+            m_datasetHandles.splice(
+                m_datasetHandles.begin(), m_datasetHandles, it->second);
+            return it->second->second;
+        }
+        // the Writable has moved on to another file
+        closeDatasetHandle(it->second);
+    }
+
+    DatasetHandle handle;
+    handle.file = file.id;
+    handle.dataset = H5Dopen(
+        file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
+    VERIFY(
+        handle.dataset >= 0,
+        "[HDF5] Internal error: Failed to open HDF5 dataset " +
+            concrete_h5_file_position(writable));
+    handle.dataspace = H5Dget_space(handle.dataset);
+    if (handle.dataspace < 0)
+    {
+        H5Dclose(handle.dataset);
+        throw std::runtime_error(
+            "[HDF5] Internal error: Failed to get HDF5 dataset space of " +
+            concrete_h5_file_position(writable));
+    }
+
+    m_datasetHandles.emplace_front(writable, handle);
+    m_datasetHandlesByWritable[writable] = m_datasetHandles.begin();
+    return m_datasetHandles.front().second;
+}
+
+hid_t HDF5IOHandlerImpl::getDatasetMemoryType(
+    DatasetHandle &handle, Datatype dtype)
+{
+    if (handle.datatype >= 0 && handle.dtype == dtype)
+    {
+        return handle.datatype;
+    }
+    if (handle.datatype >= 0)
+    {
+        H5Tclose(handle.datatype);
+        handle.datatype = H5I_INVALID_HID;
+    }
+
+    GetH5DataType getH5DataType({
+        {typeid(bool).name(), m_H5T_BOOL_ENUM},
+        {typeid(std::complex<float>).name(), m_H5T_CFLOAT},
+        {typeid(std::complex<double>).name(), m_H5T_CDOUBLE},
+        {typeid(std::complex<long double>).name(), m_H5T_CLONG_DOUBLE},
+    });
+    Attribute a(0);
+    a.dtype = dtype;
+    hid_t dataType = getH5DataType(a);
+    VERIFY(
+        dataType >= 0,
+        "[HDF5] Internal error: Failed to get HDF5 datatype for dataset");
+
+    herr_t status;
+    if (H5Tequal(dataType, H5T_NATIVE_LDOUBLE))
+    {
+        // openDataset() reports long double for both H5T_NATIVE_LDOUBLE and
+        // the worked-around m_H5T_LONG_DOUBLE_80_LE, so check which one
+        // this dataset actually uses.
+        hid_t checkDatasetTypeAgain = H5Dget_type(handle.dataset);
+        if (!H5Tequal(checkDatasetTypeAgain, H5T_NATIVE_LDOUBLE))
+        {
+            H5Tclose(dataType);
+            dataType = H5Tcopy(m_H5T_LONG_DOUBLE_80_LE);
+        }
+        status = H5Tclose(checkDatasetTypeAgain);
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close HDF5 dataset type");
+    }
+    else if (H5Tequal(dataType, m_H5T_CLONG_DOUBLE))
+    {
+        // Same deal for m_H5T_CLONG_DOUBLE
+        hid_t checkDatasetTypeAgain = H5Dget_type(handle.dataset);
+        if (!H5Tequal(checkDatasetTypeAgain, m_H5T_CLONG_DOUBLE))
+        {
+            H5Tclose(dataType);
+            dataType = H5Tcopy(m_H5T_CLONG_DOUBLE_80_LE);
+        }
+        status = H5Tclose(checkDatasetTypeAgain);
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close HDF5 dataset type");
+    }
+    VERIFY(
+        dataType >= 0,
+        "[HDF5] Internal error: Failed to get HDF5 datatype for dataset");
+
+    handle.dtype = dtype;
+    handle.datatype = dataType;
+    return dataType;
+}
+
+void HDF5IOHandlerImpl::closeDatasetHandle(DatasetHandles::iterator it)
+{
+    auto &handle = it->second;
+    herr_t status;
+    if (handle.datatype >= 0)
+    {
+        status = H5Tclose(handle.datatype);
+        if (status < 0)
+            std::cerr << "[HDF5] Internal error: Failed to close cached "
+                         "dataset datatype\n";
+    }
+    status = H5Sclose(handle.dataspace);
+    if (status < 0)
+        std::cerr << "[HDF5] Internal error: Failed to close cached dataset "
+                     "file space\n";
+    status = H5Dclose(handle.dataset);
+    if (status < 0)
+        std::cerr << "[HDF5] Internal error: Failed to close cached dataset\n";
+    m_datasetHandlesByWritable.erase(it->first);
+    m_datasetHandles.erase(it);
+}
+
+void HDF5IOHandlerImpl::invalidateDatasetHandle(Writable *writable)
+{
+    if (auto it = m_datasetHandlesByWritable.find(writable);
+        it != m_datasetHandlesByWritable.end())
+    {
+        closeDatasetHandle(it->second);
+    }
+}
+
+void HDF5IOHandlerImpl::invalidateDatasetHandles(hid_t file)
+{
+    for (auto it = m_datasetHandles.begin(); it != m_datasetHandles.end();)
+    {
+        auto current = it++;
+        if (current->second.file == file)
+        {
+            closeDatasetHandle(current);
+        }
+    }
+}
+
+void HDF5IOHandlerImpl::invalidateDatasetHandles()
+{
+    while (!m_datasetHandles.empty())
+    {
+        closeDatasetHandle(std::prev(m_datasetHandles.end()));
+    }
+}
+
+void HDF5IOHandlerImpl::trimDatasetHandles()
+{
+    while (m_datasetHandles.size() > m_datasetHandleCacheSize)
+    {
+        closeDatasetHandle(std::prev(m_datasetHandles.end()));
+    }
+}
+
+auto HDF5IOHandlerImpl::getFileMapping(File const &file)
+    -> FileMapping const &
+{
+    auto [it, inserted] = m_fileMappings.try_emplace(file.id);
+    if (!inserted)
+    {
+        return it->second;
+    }
+#ifndef _WIN32
+    // offsets reported by H5Dget_offset are only file offsets for the
+    // default driver
+    hid_t fapl = H5Fget_access_plist(file.id);
+    bool const defaultDriver = fapl >= 0 && H5Pget_driver(fapl) == H5FD_SEC2;
+    if (fapl >= 0)
+    {
+        H5Pclose(fapl);
+    }
+    if (!defaultDriver)
+    {
+        return it->second;
+    }
+    int fd = open(file.name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return it->second;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        auto size = static_cast<size_t>(fileStat.st_size);
+        void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            it->second.data = static_cast<char const *>(data);
+            it->second.size = size;
+        }
+    }
+    close(fd);
+#endif
+    return it->second;
+}
+
+void HDF5IOHandlerImpl::unmapFile(hid_t file)
+{
+    auto it = m_fileMappings.find(file);
+    if (it == m_fileMappings.end())
+    {
+        return;
+    }
+#ifndef _WIN32
+    if (it->second.data)
+    {
+        munmap(const_cast<char *>(it->second.data), it->second.size);
+    }
+#endif
+    m_fileMappings.erase(it);
+}
+
+void HDF5IOHandlerImpl::unmapFiles()
+{
+    while (!m_fileMappings.empty())
+    {
+        unmapFile(m_fileMappings.begin()->first);
+    }
+}
+
+char const *HDF5IOHandlerImpl::getMappedDataset(
+    DatasetHandle &handle, File const &file, Datatype dtype)
+{
+    if (!m_useMmap || !access::readOnly(m_handler->m_backendAccess))
+    {
+        return nullptr;
+    }
+#if openPMD_HAVE_MPI
+    if (m_communicator.has_value())
+    {
+        return nullptr;
+    }
+#endif
+    switch (dtype)
+    {
+    case Datatype::LONG_DOUBLE:
+    case Datatype::CLONG_DOUBLE:
+        // might be stored in the 80bit workaround types, converted by HDF5
+        return nullptr;
+    default:
+        break;
+    }
+
+    herr_t status;
+    if (!handle.storageOffsetQueried)
+    {
+        handle.storageOffsetQueried = true;
+        hid_t propertyList = H5Dget_create_plist(handle.dataset);
+        VERIFY(
+            propertyList >= 0,
+            "[HDF5] Internal error: Failed to get HDF5 dataset creation "
+            "property list");
+        if (H5Pget_layout(propertyList) == H5D_CONTIGUOUS &&
+            H5Pget_nfilters(propertyList) == 0 &&
+            H5Pget_external_count(propertyList) == 0)
+        {
+            haddr_t offset = H5Dget_offset(handle.dataset);
+            if (offset != HADDR_UNDEF)
+            {
+                handle.storageOffset = offset;
+            }
+        }
+        status = H5Pclose(propertyList);
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close HDF5 dataset creation "
+            "property list");
+    }
+    if (!handle.storageOffset.has_value())
+    {
+        return nullptr;
+    }
+
+    // the file must store the data exactly in the memory layout of dtype
+    hid_t memoryType = getDatasetMemoryType(handle, dtype);
+    hid_t fileType = H5Dget_type(handle.dataset);
+    VERIFY(fileType >= 0, "[HDF5] Internal error: Failed to get HDF5 type");
+    bool const sameLayout = H5Tequal(fileType, memoryType) > 0;
+    status = H5Tclose(fileType);
+    VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 type");
+    if (!sameLayout)
+    {
+        return nullptr;
+    }
+
+    hssize_t numPoints = H5Sget_simple_extent_npoints(handle.dataspace);
+    auto const &mapping = getFileMapping(file);
+    size_t const end = *handle.storageOffset +
+        static_cast<size_t>(numPoints) * H5Tget_size(memoryType);
+    if (!mapping.data || numPoints < 0 || end > mapping.size)
+    {
+        return nullptr;
+    }
+    return mapping.data + *handle.storageOffset;
+}
+
+void HDF5IOHandlerImpl::coalesceDatasetWrites()
+{
+    m_coalescedWrites.clear();
+#if openPMD_HAVE_MPI
+    /*
+     * With collective transfers, every rank must issue the same number of
+     * H5Dwrite calls. Runs differ between ranks, so merging them could
+     * deadlock.
+     */
+    if (m_communicator.has_value())
+    {
+        return;
+    }
+#endif
+
+    auto &work = m_handler->m_work;
+    std::queue<IOTask> remaining;
+    IOTask const *runStart = nullptr;
+    while (!work.empty())
+    {
+        IOTask task = std::move(work.front());
+        work.pop();
+        if (task.operation != Operation::WRITE_DATASET)
+        {
+            runStart = nullptr;
+            remaining.push(std::move(task));
+            continue;
+        }
+
+        auto const &param = *static_cast<
+            Parameter<Operation::WRITE_DATASET> const *>(task.parameter.get());
+        bool const mergeable = !param.extent.empty() &&
+            param.extent.size() == param.offset.size() &&
+            param.data.get() != nullptr;
+        if (!mergeable)
+        {
+            runStart = nullptr;
+            remaining.push(std::move(task));
+            continue;
+        }
+
+        if (runStart)
+        {
+            auto const &runParam =
+                *static_cast<Parameter<Operation::WRITE_DATASET> const *>(
+                    runStart->parameter.get());
+            if (runStart->writable == task.writable &&
+                runParam.dtype == param.dtype &&
+                runParam.extent.size() == param.extent.size())
+            {
+                m_coalescedWrites[&runParam].push_back(
+                    std::move(task.parameter));
+                continue;
+            }
+        }
+        remaining.push(std::move(task));
+        runStart = &remaining.back();
+    }
+    work = std::move(remaining);
+}
+
 std::future<void> HDF5IOHandlerImpl::flush(internal::ParsedFlushParams &params)
 {
+    coalesceDatasetWrites();
     auto res = AbstractIOHandlerImpl::flush();
 
     if (params.backendConfig.json().contains("hdf5"))
     {
         auto hdf5_config = params.backendConfig["hdf5"];
 
-        if (auto shadow = hdf5_config.invertShadow(); shadow.size() > 0)
+        if (auto shadow = params.reportUnusedOptions
+                ? hdf5_config.invertShadow()
+                : nlohmann::json::object();
+            shadow.size() > 0)
         {
             switch (hdf5_config.originallySpecifiedAs)
             {
@@ -2986,6 +3716,11 @@ std::future<void> HDF5IOHandler::flush(internal::ParsedFlushParams &params)
 {
     return m_impl->flush(params);
 }
+
+bool HDF5IOHandler::supportsReadBufferView() const
+{
+    return m_impl->m_useMmap && access::readOnly(m_backendAccess);
+}
 #else
 
 HDF5IOHandler::HDF5IOHandler(
@@ -3004,5 +3739,10 @@ std::future<void> HDF5IOHandler::flush(internal::ParsedFlushParams &)
 {
     return std::future<void>();
 }
+
+bool HDF5IOHandler::supportsReadBufferView() const
+{
+    return false;
+}
 #endif
 } // namespace openPMD
@@ -188,6 +188,17 @@ ParallelHDF5IOHandlerImpl::ParallelHDF5IOHandlerImpl(
         status >= 0,
         "[HDF5] Internal error: Failed to set HDF5 file access property");
 
+    /*
+     * Evicting cached dataset handles depends on the datasets accessed by
+     * each rank, so ranks would close their handles at different times.
+     * Only keep handles open if explicitly requested.
+     */
+    if (m_config.json().is_null() ||
+        !m_config.json().contains("dataset_handle_cache_size"))
+    {
+        m_datasetHandleCacheSize = 0;
+    }
+
     if (!m_config.json().is_null() && m_config.json().contains("vfd"))
     {
         auto vfd_json_config = m_config["vfd"];
@@ -358,6 +369,8 @@ ParallelHDF5IOHandlerImpl::ParallelHDF5IOHandlerImpl(
 
 ParallelHDF5IOHandlerImpl::~ParallelHDF5IOHandlerImpl()
 {
+    invalidateDatasetHandles();
+
     herr_t status;
     while (!m_openFileIDs.empty())
     {
@@ -131,6 +131,9 @@ namespace internal
         case Operation::GET_BUFFER_VIEW:
             return "GET_BUFFER_VIEW";
             break;
+        case Operation::READ_BUFFER_VIEW:
+            return "READ_BUFFER_VIEW";
+            break;
         case Operation::DELETE_ATT:
             return "DELETE_ATT";
             break;
@@ -149,6 +152,9 @@ namespace internal
         case Operation::AVAILABLE_CHUNKS:
             return "AVAILABLE_CHUNKS";
             break;
+        case Operation::PREFETCH_FILES:
+            return "PREFETCH_FILES";
+            break;
         default:
             return "unknown";
             break;
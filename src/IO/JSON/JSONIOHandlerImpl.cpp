@@ -37,9 +37,16 @@
 #include <toml.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <exception>
+#include <fstream>
 #include <iostream>
 #include <optional>
+#include <thread>
+#include <type_traits>
 
 namespace openPMD
 {
@@ -125,42 +132,566 @@ namespace
         }
         return *accum_ptr;
     }
+
+    /*
+     * Subtypes of nlohmann::json::binary_t, remembering how datasets are
+     * stored on disk.
+     */
+    constexpr std::uint8_t base64Subtype = 0;
+    constexpr std::uint8_t sidecarSubtype = 1;
+
+    std::string nativeByteOrder()
+    {
+        std::uint16_t const probe = 1;
+        unsigned char firstByte = 0;
+        std::memcpy(&firstByte, &probe, 1);
+        return firstByte == 1 ? "little" : "big";
+    }
+
+    constexpr char const *base64Alphabet =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string base64Encode(std::vector<std::uint8_t> const &bytes)
+    {
+        std::string res;
+        res.reserve((bytes.size() + 2) / 3 * 4);
+        size_t i = 0;
+        for (; i + 2 < bytes.size(); i += 3)
+        {
+            std::uint32_t triple =
+                (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+            res.push_back(base64Alphabet[(triple >> 18) & 63]);
+            res.push_back(base64Alphabet[(triple >> 12) & 63]);
+            res.push_back(base64Alphabet[(triple >> 6) & 63]);
+            res.push_back(base64Alphabet[triple & 63]);
+        }
+        if (i < bytes.size())
+        {
+            std::uint32_t triple = bytes[i] << 16;
+            if (i + 1 < bytes.size())
+            {
+                triple |= bytes[i + 1] << 8;
+            }
+            res.push_back(base64Alphabet[(triple >> 18) & 63]);
+            res.push_back(base64Alphabet[(triple >> 12) & 63]);
+            res.push_back(
+                i + 1 < bytes.size() ? base64Alphabet[(triple >> 6) & 63]
+                                     : '=');
+            res.push_back('=');
+        }
+        return res;
+    }
+
+    std::vector<std::uint8_t> base64Decode(std::string const &encoded)
+    {
+        std::array<int, 256> lookup;
+        lookup.fill(-1);
+        for (int i = 0; i < 64; ++i)
+        {
+            lookup[static_cast<unsigned char>(base64Alphabet[i])] = i;
+        }
+        std::vector<std::uint8_t> res;
+        res.reserve(encoded.size() / 4 * 3);
+        std::uint32_t accum = 0;
+        int bits = 0;
+        for (char c : encoded)
+        {
+            if (c == '=')
+            {
+                break;
+            }
+            int value = lookup[static_cast<unsigned char>(c)];
+            if (value < 0)
+            {
+                throw std::runtime_error(
+                    "[JSON] Invalid character in base64-encoded dataset.");
+            }
+            accum = (accum << 6) | static_cast<std::uint32_t>(value);
+            bits += 6;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                res.push_back(static_cast<std::uint8_t>((accum >> bits) & 255));
+            }
+        }
+        return res;
+    }
+
+    /*
+     * Copy a hyperslab between a contiguous buffer and the row-major raw
+     * bytes of a whole dataset. One memcpy per contiguous row.
+     */
+    template <bool intoDataset>
+    void syncHyperslab(
+        std::uint8_t *dataset,
+        Extent const &datasetExtent,
+        std::conditional_t<intoDataset, std::uint8_t const *, std::uint8_t *>
+            slab,
+        Offset const &offset,
+        Extent const &extent,
+        size_t elementSize)
+    {
+        size_t const dims = extent.size();
+        for (auto e : extent)
+        {
+            if (e == 0)
+            {
+                return;
+            }
+        }
+        size_t const rowBytes = (dims == 0 ? 1 : extent.back()) * elementSize;
+        // index within the slab, without the last (contiguous) dimension
+        std::vector<size_t> index(dims == 0 ? 0 : dims - 1, 0);
+        while (true)
+        {
+            size_t datasetIndex = 0;
+            for (size_t d = 0; d < dims; ++d)
+            {
+                datasetIndex = datasetIndex * datasetExtent[d] + offset[d] +
+                    (d < index.size() ? index[d] : 0);
+            }
+            if constexpr (intoDataset)
+            {
+                std::memcpy(
+                    dataset + datasetIndex * elementSize, slab, rowBytes);
+            }
+            else
+            {
+                std::memcpy(
+                    slab, dataset + datasetIndex * elementSize, rowBytes);
+            }
+            slab += rowBytes;
+
+            size_t d = index.size();
+            for (; d > 0; --d)
+            {
+                if (++index[d - 1] < extent[d - 1])
+                {
+                    break;
+                }
+                index[d - 1] = 0;
+            }
+            if (d == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    // copy a hyperslab out of nested JSON arrays
+    nlohmann::json sliceJson(
+        nlohmann::json const &data,
+        Offset const &offset,
+        Extent const &extent,
+        size_t dim = 0)
+    {
+        if (dim == offset.size())
+        {
+            return data;
+        }
+        nlohmann::json res = nlohmann::json::array();
+        for (size_t i = 0; i < extent[dim]; ++i)
+        {
+            res.push_back(
+                sliceJson(data.at(offset[dim] + i), offset, extent, dim + 1));
+        }
+        return res;
+    }
+
+    // inverse of sliceJson()
+    void patchJson(
+        nlohmann::json &data,
+        nlohmann::json const &slab,
+        Offset const &offset,
+        size_t dim = 0)
+    {
+        if (dim == offset.size())
+        {
+            data = slab;
+            return;
+        }
+        for (size_t i = 0; i < slab.size(); ++i)
+        {
+            patchJson(data[offset[dim] + i], slab[i], offset, dim + 1);
+        }
+    }
+
+    size_t numberOfBytes(Extent const &extent, Datatype dtype)
+    {
+        size_t res = toBytes(dtype);
+        for (auto e : extent)
+        {
+            res *= e;
+        }
+        return res;
+    }
+
+    // pre-declare since this one is recursive
+    void collectBinaryData(nlohmann::json &, std::vector<nlohmann::json *> &);
+    void collectBinaryData(
+        nlohmann::json &j, std::vector<nlohmann::json *> &binaryNodes)
+    {
+        if (j.is_binary())
+        {
+            binaryNodes.push_back(&j);
+        }
+        else if (j.is_object())
+        {
+            for (auto &child : j)
+            {
+                collectBinaryData(child, binaryNodes);
+            }
+        }
+    }
+
+    /*
+     * SAX handler building the JSON value like the DOM parser, except for
+     * the "data" arrays of datasets: only their byte range within the file
+     * and their extent is recorded, as {"lazy_range": [offset, size],
+     * "extent": [...]}.
+     */
+    class LazyDatasetParser : public nlohmann::json_sax<nlohmann::json>
+    {
+        using json = nlohmann::json;
+
+    public:
+        LazyDatasetParser(json &result, std::istream &stream)
+            : m_result(result), m_stream(stream)
+        {}
+
+        bool null() override
+        {
+            return skipping() ? skipValue() : put(nullptr);
+        }
+        bool boolean(bool val) override
+        {
+            return skipping() ? skipValue() : put(val);
+        }
+        bool number_integer(number_integer_t val) override
+        {
+            return skipping() ? skipValue() : put(val);
+        }
+        bool number_unsigned(number_unsigned_t val) override
+        {
+            return skipping() ? skipValue() : put(val);
+        }
+        bool number_float(number_float_t val, string_t const &) override
+        {
+            return skipping() ? skipValue() : put(val);
+        }
+        bool string(string_t &val) override
+        {
+            return skipping() ? skipValue() : put(std::move(val));
+        }
+        bool binary(binary_t &val) override
+        {
+            return skipping() ? skipValue() : put(std::move(val));
+        }
+        bool start_object(std::size_t) override
+        {
+            if (skipping())
+            {
+                skipValue();
+                m_nesting.push_back({0, false});
+                return true;
+            }
+            put(json::value_t::object);
+            m_stack.push_back(m_last);
+            return true;
+        }
+        bool key(string_t &val) override
+        {
+            if (skipping())
+            {
+                return true;
+            }
+            m_nextIsData = val == "data";
+            m_member = &(*m_stack.back())[std::move(val)];
+            return true;
+        }
+        bool end_object() override
+        {
+            if (skipping())
+            {
+                m_nesting.pop_back();
+            }
+            else
+            {
+                m_stack.pop_back();
+            }
+            return true;
+        }
+        bool start_array(std::size_t) override
+        {
+            if (skipping())
+            {
+                skipValue();
+                m_nesting.push_back({0, true});
+                return true;
+            }
+            if (m_nextIsData)
+            {
+                m_nextIsData = false;
+                // the opening bracket has just been consumed
+                m_begin = position() - 1;
+                m_nesting.push_back({0, true});
+                m_extent.clear();
+                return true;
+            }
+            put(json::value_t::array);
+            m_stack.push_back(m_last);
+            return true;
+        }
+        bool end_array() override
+        {
+            if (!skipping())
+            {
+                m_stack.pop_back();
+                return true;
+            }
+            auto depth = m_nesting.size() - 1;
+            if (m_extent.size() <= depth)
+            {
+                m_extent.resize(depth + 1);
+            }
+            // the first array to end on each level determines the extent
+            if (!m_extent[depth].has_value())
+            {
+                m_extent[depth] = m_nesting.back().elements;
+            }
+            m_nesting.pop_back();
+            return m_nesting.empty() ? putPlaceholder() : true;
+        }
+        bool parse_error(
+            std::size_t, std::string const &, json::exception const &ex)
+            override
+        {
+            throw std::runtime_error(
+                std::string("[JSON] Failed parsing file: ") + ex.what());
+        }
+
+    private:
+        json &m_result;
+        std::istream &m_stream;
+        // the objects and arrays currently open, innermost last
+        std::vector<json *> m_stack;
+        // the object member named by the last key
+        json *m_member = nullptr;
+        // the value put last
+        json *m_last = nullptr;
+        bool m_nextIsData = false;
+
+        struct Nesting
+        {
+            std::uint64_t elements;
+            bool isArray;
+        };
+        // non-empty while within a "data" array
+        std::vector<Nesting> m_nesting;
+        std::uint64_t m_begin = 0;
+        std::vector<std::optional<std::uint64_t>> m_extent;
+
+        bool skipping() const
+        {
+            return !m_nesting.empty();
+        }
+
+        bool skipValue()
+        {
+            ++m_nesting.back().elements;
+            return true;
+        }
+
+        template <typename Value>
+        bool put(Value &&val)
+        {
+            m_nextIsData = false;
+            if (m_stack.empty())
+            {
+                m_result = json(std::forward<Value>(val));
+                m_last = &m_result;
+            }
+            else if (m_stack.back()->is_array())
+            {
+                m_stack.back()->emplace_back(std::forward<Value>(val));
+                m_last = &m_stack.back()->back();
+            }
+            else
+            {
+                *m_member = json(std::forward<Value>(val));
+                m_last = m_member;
+            }
+            return true;
+        }
+
+        std::uint64_t position()
+        {
+            return static_cast<std::uint64_t>(m_stream.rdbuf()->pubseekoff(
+                0, std::ios_base::cur, std::ios_base::in));
+        }
+
+        bool putPlaceholder()
+        {
+            Extent extent;
+            for (auto const &e : m_extent)
+            {
+                if (!e.has_value())
+                {
+                    break;
+                }
+                extent.push_back(*e);
+            }
+            json placeholder;
+            placeholder["lazy_range"] = {m_begin, position() - m_begin};
+            placeholder["extent"] = extent;
+            return put(std::move(placeholder));
+        }
+    };
 } // namespace
 
 JSONIOHandlerImpl::JSONIOHandlerImpl(
     AbstractIOHandler *handler,
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
-    [[maybe_unused]] openPMD::json::TracingJSON config,
+    openPMD::json::TracingJSON config,
     FileFormat format,
     std::string originalExtension)
     : AbstractIOHandlerImpl(handler)
     , m_fileFormat{format}
     , m_originalExtension{std::move(originalExtension)}
-{}
+{
+    readConfig(config);
+}
 
 #if openPMD_HAVE_MPI
 JSONIOHandlerImpl::JSONIOHandlerImpl(
     AbstractIOHandler *handler,
     MPI_Comm comm,
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
-    [[maybe_unused]] openPMD::json::TracingJSON config,
+    openPMD::json::TracingJSON config,
     FileFormat format,
     std::string originalExtension)
     : AbstractIOHandlerImpl(handler)
     , m_communicator{comm}
     , m_fileFormat{format}
     , m_originalExtension{std::move(originalExtension)}
-{}
+{
+    readConfig(config);
+}
+#endif
+
+std::string JSONIOHandlerImpl::backendConfigKey() const
+{
+    switch (m_fileFormat)
+    {
+    case FileFormat::Json:
+        return "json";
+    case FileFormat::Toml:
+        return "toml";
+    }
+    throw std::runtime_error("Unreachable!");
+}
+
+void JSONIOHandlerImpl::readConfig(openPMD::json::TracingJSON &config)
+{
+    if (auto mode = parseDatasetMode(config); mode.has_value())
+    {
+        m_datasetMode = *mode;
+    }
+    auto const key = backendConfigKey();
+    if (config.json().contains(key) && config[key].json().contains("journal"))
+    {
+        auto const &journal = config[key]["journal"].json();
+        if (!journal.is_boolean())
+        {
+            throw error::BackendConfigSchema(
+                {key, "journal"}, "Must be of type boolean.");
+        }
+        m_journal = journal.get<bool>();
+    }
+    if (config.json().contains(key) &&
+        config[key].json().contains("lazy_datasets"))
+    {
+        auto const &lazy = config[key]["lazy_datasets"].json();
+        if (!lazy.is_boolean())
+        {
+            throw error::BackendConfigSchema(
+                {key, "lazy_datasets"}, "Must be of type boolean.");
+        }
+        m_lazyDatasets = lazy.get<bool>();
+    }
+#if openPMD_HAVE_MPI
+    // parallel output writes one file per rank, rewritten in every flush
+    if (m_communicator.has_value())
+    {
+        m_journal = false;
+    }
 #endif
+}
+
+auto JSONIOHandlerImpl::parseDatasetMode(
+    openPMD::json::TracingJSON &config) const -> std::optional<DatasetMode>
+{
+    auto const key = backendConfigKey();
+    if (!config.json().contains(key) ||
+        !config[key].json().contains("dataset") ||
+        !config[key]["dataset"].json().contains("mode"))
+    {
+        return std::nullopt;
+    }
+    auto mode = openPMD::json::asLowerCaseStringDynamic(
+        config[key]["dataset"]["mode"].json());
+    if (mode == "dataset")
+    {
+        return DatasetMode::Dataset;
+    }
+    else if (mode == "base64")
+    {
+        return DatasetMode::Base64;
+    }
+    else if (mode == "binary")
+    {
+        return DatasetMode::Binary;
+    }
+    throw error::BackendConfigSchema(
+        {key, "dataset", "mode"},
+        "Must be one of 'dataset', 'base64' or 'binary'.");
+}
 
-JSONIOHandlerImpl::~JSONIOHandlerImpl() = default;
+JSONIOHandlerImpl::~JSONIOHandlerImpl()
+{
+    // compact journals into their files
+    for (auto const &pair : m_journalChanges)
+    {
+        auto const &file = pair.first;
+        if (!file.valid() || !auxiliary::file_exists(journalPath(file)))
+        {
+            continue;
+        }
+        try
+        {
+            putJsonContents(file, false);
+        }
+        catch (std::exception const &e)
+        {
+            std::cerr << "[JSON] Failed compacting journal into file '"
+                      << *file << "': " << e.what() << std::endl;
+        }
+    }
+}
 
 std::future<void> JSONIOHandlerImpl::flush()
 {
     AbstractIOHandlerImpl::flush();
     for (auto const &file : m_dirty)
     {
-        putJsonContents(file, false);
+        if (m_journal)
+        {
+            appendToJournal(file);
+        }
+        else
+        {
+            putJsonContents(file, false);
+        }
     }
     m_dirty.clear();
     return std::future<void>();
@@ -191,6 +722,7 @@ void JSONIOHandlerImpl::createFile(
             auto file = std::get<0>(res_pair);
             m_dirty.erase(file);
             m_jsonVals.erase(file);
+            m_journalChanges.erase(file);
             file.invalidate();
         }
 
@@ -265,7 +797,7 @@ void JSONIOHandlerImpl::createPath(
         ensurePath(jsonVal, path);
     }
 
-    m_dirty.emplace(file);
+    markChanged(file, path);
     writable->written = true;
     writable->abstractFilePosition =
         std::make_shared<JSONFilePosition>(nlohmann::json::json_pointer(path));
@@ -303,6 +835,35 @@ void JSONIOHandlerImpl::createDataset(
         setAndGetFilePosition(writable, name);
         auto &dset = jsonVal[name];
         dset["datatype"] = datatypeToString(parameter.dtype);
+
+        auto datasetMode = m_datasetMode;
+        {
+            openPMD::json::TracingJSON config{
+                openPMD::json::parseOptions(parameter.options, false)};
+            if (auto mode = parseDatasetMode(config); mode.has_value())
+            {
+                datasetMode = *mode;
+            }
+            parameter.warnUnusedParameters(
+                config,
+                backendConfigKey(),
+                "Warning: parts of the backend configuration for JSON/TOML "
+                "dataset '" +
+                    name + "' remain unused:\n");
+        }
+        if (datasetMode != DatasetMode::Dataset)
+        {
+            dset["extent"] = parameter.extent;
+            dset["data"] = nlohmann::json::binary(
+                std::vector<std::uint8_t>(
+                    numberOfBytes(parameter.extent, parameter.dtype), 0),
+                datasetMode == DatasetMode::Binary ? sidecarSubtype
+                                                   : base64Subtype);
+            writable->written = true;
+            markChanged(file, filepositionOf(writable));
+            return;
+        }
+
         auto extent = parameter.extent;
         switch (parameter.dtype)
         {
@@ -321,7 +882,7 @@ void JSONIOHandlerImpl::createDataset(
             m_fileFormat == FileFormat::Json ? std::optional<Datatype>()
                                              : parameter.dtype);
         writable->written = true;
-        m_dirty.emplace(file);
+        markChanged(file, filepositionOf(writable));
     }
 }
 
@@ -355,7 +916,7 @@ void JSONIOHandlerImpl::extendDataset(
         access::write(m_handler->m_backendAccess),
         "[JSON] Cannot extend a dataset in read-only mode.")
     setAndGetFilePosition(writable);
-    refreshFileFromParent(writable);
+    auto file = refreshFileFromParent(writable);
     auto &j = obtainJsonContents(writable);
 
     try
@@ -379,6 +940,25 @@ void JSONIOHandlerImpl::extendDataset(
     }
     auto extent = parameters.extent;
     auto datatype = stringToDatatype(j["datatype"].get<std::string>());
+    if (isBinaryData(j["data"]))
+    {
+        auto &oldData = binaryData(j, file);
+        auto oldExtent = getExtent(j);
+        std::vector<std::uint8_t> newData(numberOfBytes(extent, datatype), 0);
+        syncHyperslab</* intoDataset = */ true>(
+            newData.data(),
+            extent,
+            oldData.data(),
+            Offset(extent.size(), 0),
+            oldExtent,
+            toBytes(datatype));
+        auto subtype = oldData.subtype();
+        j["extent"] = extent;
+        j["data"] = nlohmann::json::binary(std::move(newData), subtype);
+        writable->written = true;
+        markChanged(file, filepositionOf(writable));
+        return;
+    }
     switch (datatype)
     {
     case Datatype::CFLOAT:
@@ -400,6 +980,7 @@ void JSONIOHandlerImpl::extendDataset(
     mergeInto(newData, oldData);
     j["data"] = newData;
     writable->written = true;
+    markChanged(file, filepositionOf(writable));
 }
 
 namespace
@@ -604,9 +1185,22 @@ namespace
 void JSONIOHandlerImpl::availableChunks(
     Writable *writable, Parameter<Operation::AVAILABLE_CHUNKS> &parameters)
 {
-    refreshFileFromParent(writable);
+    auto file = refreshFileFromParent(writable);
     auto filePosition = setAndGetFilePosition(writable);
-    auto &j = obtainJsonContents(writable)["data"];
+    auto &dataset = obtainJsonContents(writable);
+    if (isLazyData(dataset["data"]))
+    {
+        loadLazyData(dataset, file);
+    }
+    if (isBinaryData(dataset["data"]))
+    {
+        // no tracking of written regions in base64/binary mode
+        auto extent = getExtent(dataset);
+        *parameters.chunks =
+            ChunkTable{WrittenChunkInfo(Offset(extent.size(), 0), extent)};
+        return;
+    }
+    auto &j = dataset["data"];
     *parameters.chunks = chunksInJSON(j);
     mergeChunks(*parameters.chunks);
 }
@@ -645,6 +1239,7 @@ void JSONIOHandlerImpl::closeFile(
             m_jsonVals.erase(it);
         }
         m_dirty.erase(fileIterator->second);
+        m_journalChanges.erase(fileIterator->second);
         // do not invalidate the file
         // it still exists, it is just not open
         m_files.erase(fileIterator);
@@ -721,10 +1316,12 @@ void JSONIOHandlerImpl::deleteFile(
         auto file = std::get<0>(tuple);
         m_dirty.erase(file);
         m_jsonVals.erase(file);
+        m_journalChanges.erase(file);
         file.invalidate();
     }
 
     std::remove(fullPath(filename).c_str());
+    std::remove((fullPath(filename) + ".journal").c_str());
 
     writable->written = false;
 }
@@ -769,6 +1366,7 @@ void JSONIOHandlerImpl::deletePath(
         // directory is != root
         parentDir(s);
         j = &(*obtainJsonContents(file))[nlohmann::json::json_pointer(s)];
+        markChanged(file, s);
     }
     else
     {
@@ -777,6 +1375,7 @@ void JSONIOHandlerImpl::deletePath(
             path = auxiliary::replace_first(path, "./", "");
         }
         j = &obtainJsonContents(writable);
+        markChanged(file, filepos->id.to_string());
     }
     nlohmann::json *lastPointer = j;
     bool needToDelete = true;
@@ -802,7 +1401,6 @@ void JSONIOHandlerImpl::deletePath(
         lastPointer->erase(splitPath[splitPath.size() - 1]);
     }
 
-    putJsonContents(file);
     writable->abstractFilePosition.reset();
     writable->written = false;
 }
@@ -838,13 +1436,14 @@ void JSONIOHandlerImpl::deleteDataset(
 
         parentDir(s);
         parent = &(*obtainJsonContents(file))[nlohmann::json::json_pointer(s)];
+        markChanged(file, s);
     }
     else
     {
         parent = &obtainJsonContents(writable);
+        markChanged(file, filepos->id.to_string());
     }
     parent->erase(dataset);
-    putJsonContents(file);
     writable->written = false;
     writable->abstractFilePosition.reset();
 }
@@ -859,11 +1458,11 @@ void JSONIOHandlerImpl::deleteAttribute(
     {
         return;
     }
-    setAndGetFilePosition(writable);
+    auto filepos = setAndGetFilePosition(writable);
     auto file = refreshFileFromParent(writable);
     auto &j = obtainJsonContents(writable);
     j.erase(parameters.name);
-    putJsonContents(file);
+    markChanged(file, filepos->id.to_string());
 }
 
 void JSONIOHandlerImpl::writeDataset(
@@ -879,10 +1478,25 @@ void JSONIOHandlerImpl::writeDataset(
 
     verifyDataset(parameters, j);
 
-    switchType<DatasetWriter>(parameters.dtype, j, parameters);
+    if (isBinaryData(j["data"]))
+    {
+        auto &bytes = binaryData(j, file);
+        syncHyperslab</* intoDataset = */ true>(
+            bytes.data(),
+            getExtent(j),
+            static_cast<std::uint8_t const *>(parameters.data.get()),
+            parameters.offset,
+            parameters.extent,
+            toBytes(parameters.dtype));
+    }
+    else
+    {
+        switchType<DatasetWriter>(parameters.dtype, j, parameters);
+    }
 
     writable->written = true;
-    putJsonContents(file);
+    markHyperslabChanged(
+        file, pos->id.to_string(), parameters.offset, parameters.extent);
 }
 
 void JSONIOHandlerImpl::writeAttribute(
@@ -916,19 +1530,37 @@ void JSONIOHandlerImpl::writeAttribute(
     (*jsonVal)[filePosition->id]["attributes"][parameter.name] = {
         {"datatype", datatypeToString(parameter.dtype)}, {"value", value}};
     writable->written = true;
-    m_dirty.emplace(file);
+    markChanged(
+        file, (filePosition->id / "attributes" / parameter.name).to_string());
 }
 
 void JSONIOHandlerImpl::readDataset(
     Writable *writable, Parameter<Operation::READ_DATASET> &parameters)
 {
-    refreshFileFromParent(writable);
+    auto file = refreshFileFromParent(writable);
     setAndGetFilePosition(writable);
     auto &j = obtainJsonContents(writable);
     verifyDataset(parameters, j);
 
+    if (isBinaryData(j["data"]))
+    {
+        auto &bytes = binaryData(j, file);
+        syncHyperslab</* intoDataset = */ false>(
+            bytes.data(),
+            getExtent(j),
+            static_cast<std::uint8_t *>(parameters.data.get()),
+            parameters.offset,
+            parameters.extent,
+            toBytes(parameters.dtype));
+        return;
+    }
+
     try
     {
+        if (isLazyData(j["data"]))
+        {
+            loadLazyData(j, file);
+        }
         switchType<DatasetReader>(parameters.dtype, j["data"], parameters);
     }
     catch (json::basic_json::type_error &)
@@ -1047,6 +1679,75 @@ void JSONIOHandlerImpl::touch(
     m_dirty.emplace(std::move(file));
 }
 
+void JSONIOHandlerImpl::prefetchFiles(
+    Writable *, Parameter<Operation::PREFETCH_FILES> const &parameters)
+{
+    /*
+     * Only in read-only mode, the prefetched contents are not yet associated
+     * with a File and would hence not see any modifications.
+     * Parallel reading is done collectively instead.
+     */
+    if (parameters.threads < 2 || !access::readOnly(m_handler->m_backendAccess))
+    {
+        return;
+    }
+#if openPMD_HAVE_MPI
+    if (m_communicator.has_value())
+    {
+        return;
+    }
+#endif
+
+    std::vector<std::string> filenames;
+    for (auto const &name : parameters.names)
+    {
+        auto filename = name + m_originalExtension;
+        bool notYetOpen = std::get<2>(getPossiblyExisting(filename));
+        if (notYetOpen && m_prefetchedJsonVals.count(filename) == 0)
+        {
+            filenames.push_back(std::move(filename));
+        }
+    }
+
+    // Reading and parsing is independent per file, the handler state is
+    // only updated after joining the threads.
+    std::vector<std::shared_ptr<nlohmann::json>> contents(filenames.size());
+    std::atomic_size_t next = 0;
+    auto work = [&]() {
+        for (size_t i = next++; i < filenames.size(); i = next++)
+        {
+            try
+            {
+                contents[i] = readJsonContents(File(filenames[i]));
+            }
+            catch (...)
+            {
+                // Reported upon opening the file regularly
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    auto numThreads = std::min<size_t>(parameters.threads, filenames.size());
+    for (size_t i = 1; i < numThreads; ++i)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < filenames.size(); ++i)
+    {
+        if (contents[i])
+        {
+            m_prefetchedJsonVals.emplace(
+                std::move(filenames[i]), std::move(contents[i]));
+        }
+    }
+}
+
 auto JSONIOHandlerImpl::getFilehandle(File const &fileName, Access access)
     -> std::tuple<std::unique_ptr<FILEHANDLE>, std::istream *, std::ostream *>
 {
@@ -1184,12 +1885,23 @@ Extent JSONIOHandlerImpl::getMultiplicators(Extent const &extent)
 
 Extent JSONIOHandlerImpl::getExtent(nlohmann::json &j)
 {
+    if (isBinaryData(j["data"]))
+    {
+        return j["extent"].get<Extent>();
+    }
     Extent res;
-    nlohmann::json *ptr = &j["data"];
-    while (ptr->is_array())
+    if (isLazyData(j["data"]))
     {
-        res.push_back(ptr->size());
-        ptr = &(*ptr)[0];
+        res = j["data"]["extent"].get<Extent>();
+    }
+    else
+    {
+        nlohmann::json *ptr = &j["data"];
+        while (ptr->is_array())
+        {
+            res.push_back(ptr->size());
+            ptr = &(*ptr)[0];
+        }
     }
     switch (stringToDatatype(j["datatype"].get<std::string>()))
     {
@@ -1281,25 +1993,17 @@ JSONIOHandlerImpl::obtainJsonContents(File const &file)
     {
         return it->second;
     }
+    if (auto prefetched = m_prefetchedJsonVals.find(*file);
+        prefetched != m_prefetchedJsonVals.end())
+    {
+        auto res = std::move(prefetched->second);
+        m_prefetchedJsonVals.erase(prefetched);
+        m_jsonVals.emplace(file, res);
+        return res;
+    }
     // read from file
     auto serialImplementation = [&file, this]() {
-        auto [fh, fh_with_precision, _] =
-            getFilehandle(file, Access::READ_ONLY);
-        (void)_;
-        std::shared_ptr<nlohmann::json> res =
-            std::make_shared<nlohmann::json>();
-        switch (m_fileFormat)
-        {
-        case FileFormat::Json:
-            *fh_with_precision >> *res;
-            break;
-        case FileFormat::Toml:
-            *res = openPMD::json::tomlToJson(
-                toml::parse(*fh_with_precision, *file));
-            break;
-        }
-        VERIFY(fh->good(), "[JSON] Failed reading from a file.");
-        return res;
+        return readJsonContents(file);
     };
 #if openPMD_HAVE_MPI
     auto parallelImplementation = [&file, this](MPI_Comm comm) {
@@ -1324,6 +2028,7 @@ JSONIOHandlerImpl::obtainJsonContents(File const &file)
             *res = openPMD::json::tomlToJson(as_toml);
             break;
         }
+        applyJournal(*res, file);
         return res;
     };
     std::shared_ptr<nlohmann::json> res;
@@ -1341,6 +2046,46 @@ JSONIOHandlerImpl::obtainJsonContents(File const &file)
 #endif
 
     m_jsonVals.emplace(file, res);
+    if (m_journal && access::write(m_handler->m_backendAccess))
+    {
+        // the file on disk is in sync with the contents just read
+        m_journalChanges[file] = {};
+    }
+    return res;
+}
+
+std::shared_ptr<nlohmann::json>
+JSONIOHandlerImpl::readJsonContents(File const &file)
+{
+    auto [fh, fh_with_precision, _] = getFilehandle(file, Access::READ_ONLY);
+    (void)_;
+    std::shared_ptr<nlohmann::json> res = std::make_shared<nlohmann::json>();
+    switch (m_fileFormat)
+    {
+    case FileFormat::Json:
+        // files that are modified by this handler need the full contents
+        if (m_lazyDatasets && access::readOnly(m_handler->m_backendAccess))
+        {
+            LazyDatasetParser parser(*res, *fh);
+            // not strict, as operator>>, i.e. do not read until EOF
+            nlohmann::json::sax_parse(
+                *fh_with_precision,
+                &parser,
+                nlohmann::json::input_format_t::json,
+                /* strict = */ false);
+        }
+        else
+        {
+            *fh_with_precision >> *res;
+        }
+        break;
+    case FileFormat::Toml:
+        *res =
+            openPMD::json::tomlToJson(toml::parse(*fh_with_precision, *file));
+        break;
+    }
+    VERIFY(fh->good(), "[JSON] Failed reading from a file.");
+    applyJournal(*res, file);
     return res;
 }
 
@@ -1360,14 +2105,32 @@ auto JSONIOHandlerImpl::putJsonContents(
         filename.valid(),
         "[JSON] File has been overwritten/deleted before writing");
     auto it = m_jsonVals.find(filename);
-    if (it == m_jsonVals.end())
+    // Read-only handlers leave the files untouched, so their modification
+    // times stay valid e.g. for the metadata index of file-based Series.
+    if (it == m_jsonVals.end() ||
+        access::readOnly(m_handler->m_backendAccess))
     {
         return it;
     }
 
     (*it->second)["platform_byte_widths"] = platformSpecifics();
+    // The sidecar file is about to be overwritten
+    loadBinaryData(*it->second, filename);
 
     auto writeSingleFile = [this, &it](std::string const &writeThisFile) {
+        /*
+         * Datasets in base64/binary mode are held as raw bytes in memory.
+         * Swap in their representation on disk while writing the file.
+         */
+        auto rawData = encodeBinaryData(
+            *it->second, fullPath(writeThisFile) + ".bin", false);
+        auto restoreRawData = [&rawData]() {
+            for (auto &[node, bytes] : rawData)
+            {
+                *node = std::move(bytes);
+            }
+        };
+
         auto [fh, _, fh_with_precision] =
             getFilehandle(File(writeThisFile), Access::CREATE);
         (void)_;
@@ -1383,6 +2146,7 @@ auto JSONIOHandlerImpl::putJsonContents(
                                << std::endl;
             break;
         }
+        restoreRawData();
 
         VERIFY(fh->good(), "[JSON] Failed writing data to disk.")
     };
@@ -1482,6 +2246,15 @@ merge the .json files somehow (no tooling provided for this (yet)).
 #else
     serialImplementation();
 #endif
+    if (m_journal)
+    {
+        m_journalChanges[filename] = {};
+    }
+    // the journal has been compacted into the file
+    if (auto journal = journalPath(filename); auxiliary::file_exists(journal))
+    {
+        std::remove(journal.c_str());
+    }
     if (unsetDirty)
     {
         m_dirty.erase(filename);
@@ -1569,7 +2342,364 @@ bool JSONIOHandlerImpl::isDataset(nlohmann::json const &j)
         return false;
     }
     auto i = j.find("data");
-    return i != j.end() && i.value().is_array();
+    return i != j.end() &&
+        (i.value().is_array() || isBinaryData(i.value()) ||
+         isLazyData(i.value()));
+}
+
+bool JSONIOHandlerImpl::isBinaryData(nlohmann::json const &data)
+{
+    return data.is_binary() ||
+        (data.is_object() &&
+         (data.contains("base64") || data.contains("offset")));
+}
+
+bool JSONIOHandlerImpl::isLazyData(nlohmann::json const &data)
+{
+    return data.is_object() && data.contains("lazy_range");
+}
+
+void JSONIOHandlerImpl::loadLazyData(nlohmann::json &dataset, File const &file)
+{
+    auto const &range = dataset["data"]["lazy_range"];
+    auto offset = range.at(0).get<std::uint64_t>();
+    std::string serialized(range.at(1).get<std::uint64_t>(), '\0');
+    auto path = fullPath(file);
+    std::ifstream in(path, std::ios_base::in | std::ios_base::binary);
+    in.seekg(static_cast<std::streamoff>(offset));
+    in.read(serialized.data(), static_cast<std::streamsize>(serialized.size()));
+    VERIFY_ALWAYS(
+        in.good(), "[JSON] Failed reading dataset from file '" + path + "'.")
+    dataset["data"] = nlohmann::json::parse(serialized);
+}
+
+nlohmann::json::binary_t &
+JSONIOHandlerImpl::binaryData(nlohmann::json &dataset, File const &file)
+{
+    auto &data = dataset["data"];
+    if (data.is_binary())
+    {
+        return data.get_binary();
+    }
+    VERIFY_ALWAYS(
+        data.value("byte_order", "") == nativeByteOrder(),
+        "[JSON] Datasets in base64/binary mode can only be read on "
+        "platforms with the same byte order as the writer.")
+    std::vector<std::uint8_t> bytes;
+    std::uint8_t subtype = base64Subtype;
+    if (data.contains("base64"))
+    {
+        bytes = base64Decode(data["base64"].get<std::string>());
+    }
+    else
+    {
+        subtype = sidecarSubtype;
+        auto path = fullPath(file) + ".bin";
+        auto offset = data["offset"].get<std::uint64_t>();
+        bytes.resize(data["size"].get<std::uint64_t>());
+        // one contiguous read per dataset
+        std::ifstream sidecar(path, std::ios_base::in | std::ios_base::binary);
+        sidecar.seekg(static_cast<std::streamoff>(offset));
+        sidecar.read(
+            reinterpret_cast<char *>(bytes.data()),
+            static_cast<std::streamsize>(bytes.size()));
+        VERIFY_ALWAYS(
+            sidecar.good(),
+            "[JSON] Failed reading dataset from sidecar file '" + path + "'.")
+    }
+    VERIFY_ALWAYS(
+        bytes.size() ==
+            numberOfBytes(
+                dataset["extent"].get<Extent>(),
+                stringToDatatype(dataset["datatype"].get<std::string>())),
+        "[JSON] Size of dataset in base64/binary mode does not match its "
+        "extent.")
+    data = nlohmann::json::binary(std::move(bytes), subtype);
+    return data.get_binary();
+}
+
+void JSONIOHandlerImpl::loadBinaryData(nlohmann::json &j, File const &file)
+{
+    if (!j.is_object())
+    {
+        return;
+    }
+    if (auto data = j.find("data"); data != j.end() && data->is_object() &&
+        data->contains("offset"))
+    {
+        binaryData(j, file);
+        return;
+    }
+    for (auto &child : j)
+    {
+        loadBinaryData(child, file);
+    }
+}
+
+auto JSONIOHandlerImpl::encodeBinaryData(
+    nlohmann::json &j, std::string const &sidecarPath, bool append)
+    -> std::vector<std::pair<nlohmann::json *, nlohmann::json::binary_t>>
+{
+    std::vector<nlohmann::json *> binaryNodes;
+    collectBinaryData(j, binaryNodes);
+    std::vector<std::pair<nlohmann::json *, nlohmann::json::binary_t>> rawData;
+    rawData.reserve(binaryNodes.size());
+    std::ofstream sidecar;
+    std::uint64_t sidecarOffset = 0;
+    for (auto *node : binaryNodes)
+    {
+        rawData.emplace_back(node, std::move(node->get_binary()));
+        auto const &bytes = rawData.back().second;
+        nlohmann::json encoded{{"byte_order", nativeByteOrder()}};
+        if (bytes.has_subtype() && bytes.subtype() == sidecarSubtype)
+        {
+            if (!sidecar.is_open())
+            {
+                sidecar.open(
+                    sidecarPath,
+                    std::ios_base::out | std::ios_base::binary |
+                        (append ? std::ios_base::app : std::ios_base::trunc));
+                sidecar.seekp(0, std::ios_base::end);
+                sidecarOffset = static_cast<std::uint64_t>(sidecar.tellp());
+            }
+            sidecar.write(
+                reinterpret_cast<char const *>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+            encoded["offset"] = sidecarOffset;
+            encoded["size"] = bytes.size();
+            sidecarOffset += bytes.size();
+        }
+        else
+        {
+            encoded["base64"] = base64Encode(bytes);
+        }
+        *node = std::move(encoded);
+    }
+    if (sidecar.is_open())
+    {
+        sidecar.close();
+        if (!sidecar.good())
+        {
+            for (auto &[node, bytes] : rawData)
+            {
+                *node = std::move(bytes);
+            }
+            throw std::runtime_error(
+                "[JSON] Failed writing sidecar file '" + sidecarPath + "'.");
+        }
+    }
+    return rawData;
+}
+
+std::string JSONIOHandlerImpl::journalPath(File const &file)
+{
+    return fullPath(file) + ".journal";
+}
+
+void JSONIOHandlerImpl::markChanged(File const &file, std::string jsonPointer)
+{
+    m_dirty.emplace(file);
+    if (auto it = m_journalChanges.find(file); it != m_journalChanges.end())
+    {
+        it->second.paths.push_back(std::move(jsonPointer));
+    }
+}
+
+void JSONIOHandlerImpl::markHyperslabChanged(
+    File const &file, std::string datasetPointer, Offset offset, Extent extent)
+{
+    m_dirty.emplace(file);
+    if (auto it = m_journalChanges.find(file); it != m_journalChanges.end())
+    {
+        it->second.hyperslabs.emplace_back(
+            std::move(datasetPointer), std::move(offset), std::move(extent));
+    }
+}
+
+void JSONIOHandlerImpl::appendToJournal(File const &file)
+{
+    auto changes = m_journalChanges.find(file);
+    auto contents = m_jsonVals.find(file);
+    if (changes == m_journalChanges.end() || contents == m_jsonVals.end() ||
+        std::find(
+            changes->second.paths.begin(), changes->second.paths.end(), "") !=
+            changes->second.paths.end())
+    {
+        putJsonContents(file, false);
+        return;
+    }
+    auto &paths = changes->second.paths;
+    std::sort(paths.begin(), paths.end());
+    paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+    auto &hyperslabs = changes->second.hyperslabs;
+    std::sort(hyperslabs.begin(), hyperslabs.end());
+    hyperslabs.erase(
+        std::unique(hyperslabs.begin(), hyperslabs.end()), hyperslabs.end());
+
+    /*
+     * One line per flush, each an array of operations in the style of
+     * JSON Patch (RFC 6902), plus "hyperslab" operations that patch a
+     * region of a dataset. The values are copied from the current state,
+     * so the order in which changes happened does not matter and changes
+     * within an already-recorded subtree can be skipped.
+     */
+    std::unordered_set<std::string> recorded;
+    auto isCovered = [&recorded](std::string const &path, bool inclusive) {
+        if (inclusive && recorded.find(path) != recorded.end())
+        {
+            return true;
+        }
+        for (auto pos = path.rfind('/'); pos != 0 && pos != std::string::npos;
+             pos = path.rfind('/', pos - 1))
+        {
+            if (recorded.find(path.substr(0, pos)) != recorded.end())
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    nlohmann::json patch = nlohmann::json::array();
+    for (auto const &path : paths)
+    {
+        if (isCovered(path, false))
+        {
+            continue;
+        }
+        recorded.emplace(path);
+        nlohmann::json::json_pointer pointer(path);
+        if (contents->second->contains(pointer))
+        {
+            patch.push_back(
+                {{"op", "add"},
+                 {"path", path},
+                 {"value", (*contents->second)[pointer]}});
+        }
+        else
+        {
+            patch.push_back({{"op", "remove"}, {"path", path}});
+        }
+    }
+    for (auto const &[path, offset, extent] : hyperslabs)
+    {
+        nlohmann::json::json_pointer pointer(path);
+        if (isCovered(path, true) || !contents->second->contains(pointer) ||
+            std::find(extent.begin(), extent.end(), 0) != extent.end())
+        {
+            continue;
+        }
+        auto &dataset = (*contents->second)[pointer];
+        nlohmann::json value;
+        if (isBinaryData(dataset["data"]))
+        {
+            auto &bytes = binaryData(dataset, file);
+            auto dtype =
+                stringToDatatype(dataset["datatype"].get<std::string>());
+            std::vector<std::uint8_t> slab(numberOfBytes(extent, dtype));
+            syncHyperslab</* intoDataset = */ false>(
+                bytes.data(),
+                getExtent(dataset),
+                slab.data(),
+                offset,
+                extent,
+                toBytes(dtype));
+            value = nlohmann::json::binary(std::move(slab), bytes.subtype());
+        }
+        else
+        {
+            value = sliceJson(dataset["data"], offset, extent);
+        }
+        patch.push_back(
+            {{"op", "hyperslab"},
+             {"path", path},
+             {"offset", offset},
+             {"extent", extent},
+             {"value", std::move(value)}});
+    }
+    paths.clear();
+    hyperslabs.clear();
+    if (patch.empty())
+    {
+        return;
+    }
+    // binary mode datasets are appended to the sidecar file, leaving the
+    // data referred to by the file and earlier journal entries intact
+    for (auto &operation : patch)
+    {
+        if (auto value = operation.find("value"); value != operation.end())
+        {
+            encodeBinaryData(*value, fullPath(file) + ".bin", true);
+        }
+    }
+
+    std::ofstream journal(
+        journalPath(file), std::ios_base::out | std::ios_base::app);
+    journal << patch.dump() << '\n';
+    journal.close();
+    VERIFY(journal.good(), "[JSON] Failed writing to journal.")
+}
+
+void JSONIOHandlerImpl::applyJournal(nlohmann::json &j, File const &file)
+{
+    std::ifstream journal(journalPath(file));
+    if (!journal.is_open())
+    {
+        return;
+    }
+    std::string line;
+    while (std::getline(journal, line))
+    {
+        nlohmann::json patch = nlohmann::json::parse(
+            line, /* cb = */ nullptr, /* allow_exceptions = */ false);
+        if (patch.is_discarded())
+        {
+            // incompletely written last entry, e.g. after a crash
+            break;
+        }
+        for (auto const &operation : patch)
+        {
+            nlohmann::json::json_pointer pointer(
+                operation.at("path").get<std::string>());
+            if (operation.at("op") == "add")
+            {
+                j[pointer] = operation.at("value");
+            }
+            else if (operation.at("op") == "hyperslab")
+            {
+                auto &dataset = j[pointer];
+                auto offset = operation.at("offset").get<Offset>();
+                auto extent = operation.at("extent").get<Extent>();
+                if (isBinaryData(dataset["data"]))
+                {
+                    // decode the payload like a dataset of the slab's extent
+                    nlohmann::json slab{
+                        {"data", operation.at("value")},
+                        {"datatype", dataset["datatype"]},
+                        {"extent", extent}};
+                    syncHyperslab</* intoDataset = */ true>(
+                        binaryData(dataset, file).data(),
+                        getExtent(dataset),
+                        binaryData(slab, file).data(),
+                        offset,
+                        extent,
+                        toBytes(stringToDatatype(
+                            dataset["datatype"].get<std::string>())));
+                }
+                else
+                {
+                    if (isLazyData(dataset["data"]))
+                    {
+                        loadLazyData(dataset, file);
+                    }
+                    patchJson(dataset["data"], operation.at("value"), offset);
+                }
+            }
+            else if (j.contains(pointer))
+            {
+                j[pointer.parent_pointer()].erase(pointer.back());
+            }
+        }
+    }
 }
 
 bool JSONIOHandlerImpl::isGroup(nlohmann::json::const_iterator const &it)
@@ -1581,7 +2711,9 @@ bool JSONIOHandlerImpl::isGroup(nlohmann::json::const_iterator const &it)
         return false;
     }
     auto i = j.find("data");
-    return i == j.end() || !i.value().is_array();
+    return i == j.end() ||
+        !(i.value().is_array() || isBinaryData(i.value()) ||
+          isLazyData(i.value()));
 }
 
 template <typename Param>
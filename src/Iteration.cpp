@@ -29,8 +29,10 @@
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/backend/Writable.hpp"
 
+#include <charconv>
 #include <exception>
 #include <iostream>
+#include <map>
 #include <tuple>
 
 namespace openPMD
@@ -332,6 +334,13 @@ void Iteration::flush(internal::FlushParams const &flushParams)
          * meshesPath and particlesPath are stored there */
         Series s = retrieveSeries();
 
+        if (s.get().m_computeStatistics &&
+            get().m_closed == internal::CloseStatus::ClosedInFrontend &&
+            flushParams.flushLevel != FlushLevel::SkeletonOnly)
+        {
+            writeStatistics(s.get());
+        }
+
         if (!meshes.empty() || s.containsAttribute("meshesPath"))
         {
             if (!s.containsAttribute("meshesPath"))
@@ -374,6 +383,33 @@ void Iteration::flush(internal::FlushParams const &flushParams)
     }
 }
 
+void Iteration::writeStatistics(internal::SeriesData const &series)
+{
+    std::map<std::string, RecordComponent> components;
+    for (auto &[meshName, mesh] : meshes)
+    {
+        for (auto &[componentName, component] : mesh)
+        {
+            components.emplace(
+                "meshes/" + meshName + "/" + componentName, component);
+        }
+    }
+    for (auto &[speciesName, species] : particles)
+    {
+        for (auto &[recordName, record] : species)
+        {
+            for (auto &[componentName, component] : record)
+            {
+                components.emplace(
+                    "particles/" + speciesName + "/" + recordName + "/" +
+                        componentName,
+                    component);
+            }
+        }
+    }
+    RecordComponent::writeStatistics(components, series);
+}
+
 void Iteration::deferParseAccess(DeferredParseAccess dr)
 {
     get().m_deferredParseAccess =
@@ -582,9 +618,15 @@ void Iteration::readMeshes(std::string const &meshesPath)
     IOHandler()->enqueue(IOTask(&meshes, pList));
     IOHandler()->flush(internal::defaultFlushParams);
 
+    auto series = retrieveSeries();
+
     Parameter<Operation::LIST_ATTS> aList;
     for (auto const &mesh_name : *pList.paths)
     {
+        if (!series.get().passesReadFilter("meshes/" + mesh_name))
+        {
+            continue;
+        }
         Mesh &m = map[mesh_name];
         pOpen.path = mesh_name;
         aList.attributes->clear();
@@ -624,6 +666,10 @@ void Iteration::readMeshes(std::string const &meshesPath)
     Parameter<Operation::OPEN_DATASET> dOpen;
     for (auto const &mesh_name : *dList.datasets)
     {
+        if (!series.get().passesReadFilter("meshes/" + mesh_name))
+        {
+            continue;
+        }
         Mesh &m = map[mesh_name];
         dOpen.name = mesh_name;
         IOHandler()->enqueue(IOTask(&m, dOpen));
@@ -663,9 +709,15 @@ void Iteration::readParticles(std::string const &particlesPath)
     IOHandler()->enqueue(IOTask(&particles, pList));
     IOHandler()->flush(internal::defaultFlushParams);
 
+    auto series = retrieveSeries();
+
     internal::EraseStaleEntries<decltype(particles)> map{particles};
     for (auto const &species_name : *pList.paths)
     {
+        if (!series.get().passesReadFilter("particles/" + species_name))
+        {
+            continue;
+        }
         ParticleSpecies &p = map[species_name];
         pOpen.path = species_name;
         IOHandler()->enqueue(IOTask(&p, pOpen));
@@ -896,4 +948,33 @@ template Iteration &Iteration::setTime<long double>(long double time);
 template Iteration &Iteration::setDt<float>(float dt);
 template Iteration &Iteration::setDt<double>(double dt);
 template Iteration &Iteration::setDt<long double>(long double dt);
+void traits::GenerationPolicy<Iteration>::operator()(Iteration &iteration)
+{
+    iteration.notifySeriesOfCreation();
+}
+
+void Iteration::notifySeriesOfCreation()
+{
+    auto &w = writable();
+    // Iteration -> Series::iterations -> Series
+    if (!w.parent || !w.parent->parent)
+    {
+        return;
+    }
+    auto series =
+        dynamic_cast<internal::SeriesData *>(w.parent->parent->attributable);
+    if (!series || !series->m_finishedUpTo.has_value())
+    {
+        return;
+    }
+    auto const &key = w.ownKeyWithinParent;
+    Iteration::IterationIndex_t index{};
+    if (auto [end, ec] =
+            std::from_chars(key.data(), key.data() + key.size(), index);
+        ec != std::errc() || end != key.data() + key.size() ||
+        index <= *series->m_finishedUpTo)
+    {
+        series->m_finishedUpTo.reset();
+    }
+}
 } // namespace openPMD
@@ -42,11 +42,22 @@ void ParticleSpecies::read()
 
     internal::EraseStaleEntries<ParticleSpecies &> map{*this};
 
+    auto series = retrieveSeries();
+    auto passesReadFilter = [&series, this](std::string const &record_name) {
+        return series.get().passesReadFilter(
+            "particles/" + writable().ownKeyWithinParent.str() + "/" +
+            record_name);
+    };
+
     Parameter<Operation::OPEN_PATH> pOpen;
     Parameter<Operation::LIST_ATTS> aList;
     bool hasParticlePatches = false;
     for (auto const &record_name : *pList.paths)
     {
+        if (!passesReadFilter(record_name))
+        {
+            continue;
+        }
         if (record_name == "particlePatches")
         {
             hasParticlePatches = true;
@@ -115,6 +126,10 @@ void ParticleSpecies::read()
     Parameter<Operation::OPEN_DATASET> dOpen;
     for (auto const &record_name : *dList.datasets)
     {
+        if (!passesReadFilter(record_name))
+        {
+            continue;
+        }
         try
         {
             Record &r = map[record_name];
@@ -23,8 +23,11 @@
 #include "openPMD/Error.hpp"
 
 #include "openPMD/Series.hpp"
+#include "openPMD/auxiliary/Filesystem.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <optional>
 
 namespace openPMD
@@ -116,6 +119,39 @@ void SeriesIterator::initSeriesInLinearReadMode()
     series.IOHandler()->m_seriesStatus = internal::SeriesStatus::Default;
 }
 
+void SeriesIterator::prefetchUpcomingIterations()
+{
+    auto &data = get();
+    auto &series = data.series.value();
+    if (data.prefetch == 0 ||
+        series.iterationEncoding() != IterationEncoding::fileBased)
+    {
+        return;
+    }
+    /*
+     * Only the page cache is warmed up here, no openPMD state is touched,
+     * so parsing and reading remain on the calling thread.
+     * posix_fadvise() returns immediately and lets the kernel read the files
+     * in the background while the current iteration is processed.
+     */
+    auto const &container = series.iterations.container();
+    auto it = container.upper_bound(
+        data.prefetchedUpTo.has_value()
+            ? std::max(*data.prefetchedUpTo, data.currentIteration)
+            : data.currentIteration);
+    auto distance = static_cast<unsigned>(std::distance(
+        container.upper_bound(data.currentIteration), it));
+    for (; it != container.end() && distance < data.prefetch;
+         ++it, ++distance)
+    {
+        auxiliary::prefetch_file(
+            series.IOHandler()->directory +
+                series.iterationFilename(it->first),
+            data.prefetchMaxBytes);
+        data.prefetchedUpTo = it->first;
+    }
+}
+
 void SeriesIterator::close()
 {
     *m_data = std::nullopt; // turn this into end iterator
@@ -593,6 +629,7 @@ SeriesIterator &SeriesIterator::operator++()
             container.erase(oldIterationIndex);
             data.ignoreIterations.emplace(oldIterationIndex);
         }
+        prefetchUpcomingIterations();
     }
     return *resvalue;
 }
@@ -628,8 +665,13 @@ SeriesIterator SeriesIterator::end()
 ReadIterations::ReadIterations(
     Series series,
     Access access,
-    std::optional<internal::ParsePreference> parsePreference)
-    : m_series(std::move(series)), m_parsePreference(parsePreference)
+    std::optional<internal::ParsePreference> parsePreference,
+    unsigned prefetch,
+    std::uint64_t prefetchMaxBytes)
+    : m_series(std::move(series))
+    , m_parsePreference(parsePreference)
+    , m_prefetch(prefetch)
+    , m_prefetchMaxBytes(prefetchMaxBytes)
 {
     auto &data = m_series.get();
     if (access == Access::READ_LINEAR && !data.m_sharedStatefulIterator)
@@ -638,6 +680,21 @@ ReadIterations::ReadIterations(
         data.m_sharedStatefulIterator =
             std::make_unique<iterator_t>(m_series, m_parsePreference);
     }
+    if (data.m_sharedStatefulIterator)
+    {
+        applyOptions(*data.m_sharedStatefulIterator);
+    }
+}
+
+void ReadIterations::applyOptions(iterator_t &iterator)
+{
+    if (!iterator.m_data->has_value())
+    {
+        return;
+    }
+    iterator.get().prefetch = m_prefetch;
+    iterator.get().prefetchMaxBytes = m_prefetchMaxBytes;
+    iterator.prefetchUpcomingIterations();
 }
 
 ReadIterations::iterator_t ReadIterations::begin()
@@ -647,6 +704,7 @@ ReadIterations::iterator_t ReadIterations::begin()
     {
         series.m_sharedStatefulIterator =
             std::make_unique<iterator_t>(m_series, m_parsePreference);
+        applyOptions(*series.m_sharedStatefulIterator);
     }
     return *series.m_sharedStatefulIterator;
 }
@@ -24,7 +24,9 @@
 #include "openPMD/Error.hpp"
 #include "openPMD/IO/Format.hpp"
 #include "openPMD/Series.hpp"
+#include "openPMD/auxiliary/DerefDynamicCast.hpp"
 #include "openPMD/auxiliary/Memory.hpp"
+#include "openPMD/auxiliary/Mpi.hpp"
 #include "openPMD/backend/Attributable.hpp"
 #include "openPMD/backend/BaseRecord.hpp"
 
@@ -32,8 +34,12 @@
 #include <climits>
 #include <complex>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <set>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 
 namespace openPMD
 {
@@ -344,6 +350,18 @@ void RecordComponent::flush(
             }
         }
 
+        auto [maybeIteration, series] = containingIteration();
+        /*
+         * When closing the Iteration, Iteration::flush() has already
+         * accumulated the pending chunks in writeStatistics().
+         */
+        if (series->m_computeStatistics &&
+            !(maybeIteration.has_value() &&
+              (*maybeIteration)->m_closed ==
+                  internal::CloseStatus::ClosedInFrontend))
+        {
+            accumulatePendingStatistics(series->m_statisticsHistogramBins);
+        }
         while (!rc.m_chunks.empty())
         {
             IOHandler()->enqueue(rc.m_chunks.front());
@@ -564,4 +582,369 @@ auto RecordComponent::loadChunkVariant(Offset o, Extent e)
 {
     return visit<LoadChunkVariant>(std::move(o), std::move(e));
 }
+
+std::shared_ptr<void> RecordComponent::acquireBuffer(size_t bytes)
+{
+    return retrieveSeries().get().m_bufferPool.acquire(bytes);
+}
+
+namespace
+{
+    template <typename T>
+    constexpr bool hasStatistics =
+        std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    // bin of value within a histogram spanning [min, max]
+    size_t histogramBin(double value, double min, double max, size_t bins)
+    {
+        double const scale = max > min ? double(bins) / (max - min) : 0.;
+        double const pos = (value - min) * scale;
+        // also maps NaN positions (infinite ranges) to the first bin
+        if (pos >= double(bins))
+        {
+            return bins - 1;
+        }
+        return pos > 0. ? static_cast<size_t>(pos) : 0;
+    }
+
+    /*
+     * Move the counts of a histogram spanning [oldMin, oldMax] into the bins
+     * of [newMin, newMax] that contain the centers of the old bins.
+     */
+    void rebinHistogram(
+        std::vector<uint64_t> &histogram,
+        double oldMin,
+        double oldMax,
+        double newMin,
+        double newMax)
+    {
+        if (oldMin == newMin && oldMax == newMax)
+        {
+            return;
+        }
+        size_t const bins = histogram.size();
+        std::vector<uint64_t> res(bins, 0);
+        for (size_t i = 0; i < bins; ++i)
+        {
+            double const center =
+                oldMin + (double(i) + 0.5) * (oldMax - oldMin) / double(bins);
+            res[histogramBin(center, newMin, newMax, bins)] += histogram[i];
+        }
+        histogram = std::move(res);
+    }
+
+    struct AccumulateRange
+    {
+        template <typename T>
+        static void call(
+            void const *ptr, size_t size, internal::StatisticsAccumulator &acc)
+        {
+            if constexpr (hasStatistics<T>)
+            {
+                auto data = static_cast<T const *>(ptr);
+                T min = std::numeric_limits<T>::max();
+                T max = std::numeric_limits<T>::lowest();
+                double sum = 0;
+                uint64_t count = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    T const value = data[i];
+                    if constexpr (std::is_floating_point_v<T>)
+                    {
+                        if (value != value)
+                        {
+                            continue;
+                        }
+                    }
+                    min = value < min ? value : min;
+                    max = value > max ? value : max;
+                    sum += static_cast<double>(value);
+                    ++count;
+                }
+                if (count > 0)
+                {
+                    acc.min = std::min(acc.min, static_cast<double>(min));
+                    acc.max = std::max(acc.max, static_cast<double>(max));
+                    acc.sum += sum;
+                    acc.count += count;
+                }
+            }
+        }
+
+        template <unsigned n, typename... Args>
+        static void call(Args &&...)
+        {}
+    };
+
+    struct AccumulateHistogram
+    {
+        template <typename T>
+        static void call(
+            void const *ptr,
+            size_t size,
+            double min,
+            double max,
+            std::vector<uint64_t> &histogram)
+        {
+            if constexpr (hasStatistics<T>)
+            {
+                auto data = static_cast<T const *>(ptr);
+                size_t const bins = histogram.size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    T const value = data[i];
+                    if constexpr (std::is_floating_point_v<T>)
+                    {
+                        if (value != value)
+                        {
+                            continue;
+                        }
+                    }
+                    ++histogram[histogramBin(
+                        static_cast<double>(value), min, max, bins)];
+                }
+            }
+        }
+
+        template <unsigned n, typename... Args>
+        static void call(Args &&...)
+        {}
+    };
+} // namespace
+
+void RecordComponent::accumulateStatistics(
+    std::vector<Parameter<Operation::WRITE_DATASET> const *> const &writes,
+    size_t histogramBins)
+{
+    auto &rc = get();
+    if (!rc.m_statistics.has_value())
+    {
+        rc.m_statistics.emplace();
+    }
+    auto &acc = *rc.m_statistics;
+    double const oldMin = acc.min;
+    double const oldMax = acc.max;
+    auto numPoints = [](Extent const &extent) {
+        size_t res = 1;
+        for (auto ext : extent)
+        {
+            res *= ext;
+        }
+        return res;
+    };
+
+    for (auto const *write : writes)
+    {
+        switchDatasetType<AccumulateRange>(
+            write->dtype, write->data.get(), numPoints(write->extent), acc);
+    }
+    if (histogramBins == 0 || acc.count == 0)
+    {
+        return;
+    }
+    // the range might have grown, so the histogram so far must be rebinned
+    if (acc.histogram.empty())
+    {
+        acc.histogram.resize(histogramBins, 0);
+    }
+    else
+    {
+        rebinHistogram(acc.histogram, oldMin, oldMax, acc.min, acc.max);
+    }
+    for (auto const *write : writes)
+    {
+        switchDatasetType<AccumulateHistogram>(
+            write->dtype,
+            write->data.get(),
+            numPoints(write->extent),
+            acc.min,
+            acc.max,
+            acc.histogram);
+    }
+}
+
+void RecordComponent::accumulatePendingStatistics(size_t histogramBins)
+{
+    auto &rc = get();
+    if (constant() || !rc.m_dataset.has_value())
+    {
+        return;
+    }
+    std::vector<Parameter<Operation::WRITE_DATASET> const *> writes;
+    auto pending = rc.m_chunks;
+    for (; !pending.empty(); pending.pop())
+    {
+        auto &task = pending.front();
+        if (task.operation == Operation::WRITE_DATASET)
+        {
+            writes.push_back(&auxiliary::deref_dynamic_cast<
+                             Parameter<Operation::WRITE_DATASET> const>(
+                task.parameter.get()));
+        }
+    }
+    // the parameters stay alive in rc.m_chunks
+    accumulateStatistics(writes, histogramBins);
+}
+
+void RecordComponent::writeStatistics(
+    std::map<std::string, RecordComponent> &components,
+    internal::SeriesData const &series)
+{
+    size_t const histogramBins = series.m_statisticsHistogramBins;
+    std::vector<std::string> names;
+    for (auto &[name, component] : components)
+    {
+        if (component.constant() || !component.get().m_dataset.has_value())
+        {
+            continue;
+        }
+        component.accumulatePendingStatistics(histogramBins);
+        names.push_back(name);
+    }
+#if openPMD_HAVE_MPI
+    if (series.m_communicator.has_value())
+    {
+        /*
+         * Ranks need not define the same components, so agree on the union
+         * of all of them and let others contribute empty statistics.
+         */
+        std::string joined;
+        for (auto const &name : names)
+        {
+            joined += name;
+            joined += '\n';
+        }
+        std::set<std::string> allNames;
+        for (auto const &fromRank : auxiliary::distributeStringsToAllRanks(
+                 *series.m_communicator, joined))
+        {
+            std::istringstream lines(fromRank);
+            for (std::string line; std::getline(lines, line);)
+            {
+                allNames.insert(std::move(line));
+            }
+        }
+        names = std::vector<std::string>(allNames.begin(), allNames.end());
+    }
+#endif
+
+    std::vector<internal::StatisticsAccumulator> accumulators(names.size());
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        auto component = components.find(names[i]);
+        if (component == components.end())
+        {
+            continue;
+        }
+        auto &stats = component->second.get().m_statistics;
+        if (stats.has_value())
+        {
+            accumulators[i] = std::move(*stats);
+            stats.reset();
+        }
+    }
+
+#if openPMD_HAVE_MPI
+    if (series.m_communicator.has_value())
+    {
+        auto comm = *series.m_communicator;
+        int const n = static_cast<int>(names.size());
+        std::vector<double> min(names.size()), max(names.size()),
+            sum(names.size());
+        std::vector<uint64_t> count(names.size());
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            min[i] = accumulators[i].min;
+            max[i] = accumulators[i].max;
+            sum[i] = accumulators[i].sum;
+            count[i] = accumulators[i].count;
+        }
+        MPI_Allreduce(MPI_IN_PLACE, min.data(), n, MPI_DOUBLE, MPI_MIN, comm);
+        MPI_Allreduce(MPI_IN_PLACE, max.data(), n, MPI_DOUBLE, MPI_MAX, comm);
+        MPI_Allreduce(MPI_IN_PLACE, sum.data(), n, MPI_DOUBLE, MPI_SUM, comm);
+        MPI_Allreduce(
+            MPI_IN_PLACE, count.data(), n, MPI_UINT64_T, MPI_SUM, comm);
+        std::vector<uint64_t> histograms;
+        if (histogramBins > 0)
+        {
+            histograms.reserve(names.size() * histogramBins);
+            for (size_t i = 0; i < names.size(); ++i)
+            {
+                auto &acc = accumulators[i];
+                if (acc.histogram.empty())
+                {
+                    acc.histogram.resize(histogramBins, 0);
+                }
+                else
+                {
+                    rebinHistogram(
+                        acc.histogram, acc.min, acc.max, min[i], max[i]);
+                }
+                histograms.insert(
+                    histograms.end(),
+                    acc.histogram.begin(),
+                    acc.histogram.end());
+            }
+            MPI_Allreduce(
+                MPI_IN_PLACE,
+                histograms.data(),
+                static_cast<int>(histograms.size()),
+                MPI_UINT64_T,
+                MPI_SUM,
+                comm);
+        }
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            auto &acc = accumulators[i];
+            acc.min = min[i];
+            acc.max = max[i];
+            acc.sum = sum[i];
+            acc.count = count[i];
+            if (histogramBins > 0)
+            {
+                auto begin = histograms.begin() + i * histogramBins;
+                acc.histogram.assign(begin, begin + histogramBins);
+            }
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        auto component = components.find(names[i]);
+        auto &acc = accumulators[i];
+        if (component == components.end() || acc.count == 0)
+        {
+            continue;
+        }
+        auto &rc = component->second;
+        rc.setAttribute("statisticsMin", acc.min);
+        rc.setAttribute("statisticsMax", acc.max);
+        rc.setAttribute("statisticsMean", acc.sum / double(acc.count));
+        rc.setAttribute("statisticsCount", acc.count);
+        if (!acc.histogram.empty())
+        {
+            rc.setAttribute("statisticsHistogram", std::move(acc.histogram));
+        }
+    }
+}
+
+std::optional<RecordComponentStatistics> RecordComponent::statistics() const
+{
+    if (!containsAttribute("statisticsCount"))
+    {
+        return std::nullopt;
+    }
+    RecordComponentStatistics res;
+    res.min = getAttribute("statisticsMin").get<double>();
+    res.max = getAttribute("statisticsMax").get<double>();
+    res.mean = getAttribute("statisticsMean").get<double>();
+    res.count = getAttribute("statisticsCount").get<uint64_t>();
+    if (containsAttribute("statisticsHistogram"))
+    {
+        res.histogram = getAttribute("statisticsHistogram")
+                            .get<std::vector<uint64_t>>();
+    }
+    return res;
+}
 } // namespace openPMD
@@ -26,6 +26,7 @@
 #include "openPMD/IO/AbstractIOHandlerHelper.hpp"
 #include "openPMD/IO/Access.hpp"
 #include "openPMD/IO/DummyIOHandler.hpp"
+#include "openPMD/IO/FlushParametersInternal.hpp"
 #include "openPMD/IO/Format.hpp"
 #include "openPMD/IO/IOTask.hpp"
 #include "openPMD/IterationEncoding.hpp"
@@ -36,15 +37,20 @@
 #include "openPMD/auxiliary/JSON_internal.hpp"
 #include "openPMD/auxiliary/Mpi.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/auxiliary/TypeTraits.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/backend/Attributable.hpp"
 #include "openPMD/version.hpp"
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstdint>
 #include <exception>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <optional>
 #include <regex>
@@ -130,6 +136,7 @@ struct Series::ParsedInput
     std::string filenamePostfix;
     std::optional<std::string> filenameExtension;
     int filenamePadding = -1;
+    unsigned asyncFlushThreads = 0;
 }; // ParsedInput
 
 std::string Series::openPMD() const
@@ -688,6 +695,11 @@ std::string Series::backend()
     return IOHandler()->backendName();
 }
 
+auxiliary::BufferPoolStatistics Series::bufferPoolStatistics() const
+{
+    return get().m_bufferPool.statistics();
+}
+
 void Series::flush(std::string backendConfig)
 {
     auto &series = get();
@@ -697,6 +709,22 @@ void Series::flush(std::string backendConfig)
         {FlushLevel::UserFlush, std::move(backendConfig)});
 }
 
+void Series::flush(FlushConfig const &backendConfig)
+{
+    auto &series = get();
+    internal::FlushParams flushParams{FlushLevel::UserFlush};
+    flushParams.preparedBackendConfig = backendConfig.m_prepared;
+    flush_impl(series.iterations.begin(), series.iterations.end(), flushParams);
+}
+
+FlushConfig Series::prepareFlushConfig(std::string const &backendConfig) const
+{
+    FlushConfig res;
+    res.m_prepared = std::make_shared<internal::PreparedFlushConfig>(
+        json::parseOptions(backendConfig, /* considerFiles = */ false));
+    return res;
+}
+
 std::unique_ptr<Series::ParsedInput> Series::parseInput(std::string filepath)
 {
     std::unique_ptr<Series::ParsedInput> input{new Series::ParsedInput};
@@ -807,20 +835,17 @@ namespace
     template <typename MappingFunction>
     int autoDetectPadding(
         std::function<Match(std::string const &)> const &isPartOfSeries,
-        std::string const &directory,
+        std::vector<std::string> const &directoryEntries,
         MappingFunction &&mappingFunction)
     {
         std::set<int> paddings;
-        if (auxiliary::directory_exists(directory))
+        for (auto const &entry : directoryEntries)
         {
-            for (auto const &entry : auxiliary::list_directory(directory))
+            Match match = isPartOfSeries(entry);
+            if (match.isContained)
             {
-                Match match = isPartOfSeries(entry);
-                if (match.isContained)
-                {
-                    paddings.insert(match.padding);
-                    mappingFunction(entry, std::move(match));
-                }
+                paddings.insert(match.padding);
+                mappingFunction(entry, std::move(match));
             }
         }
         if (paddings.size() == 1u)
@@ -831,12 +856,333 @@ namespace
             return -2;
     }
 
+    template <typename MappingFunction>
+    int autoDetectPadding(
+        std::function<Match(std::string const &)> const &isPartOfSeries,
+        std::string const &directory,
+        MappingFunction &&mappingFunction)
+    {
+        if (!auxiliary::directory_exists(directory))
+        {
+            return -1;
+        }
+        return autoDetectPadding(
+            isPartOfSeries,
+            auxiliary::list_directory(directory),
+            std::forward<MappingFunction>(mappingFunction));
+    }
+
     int autoDetectPadding(
         std::function<Match(std::string const &)> const &isPartOfSeries,
         std::string const &directory)
     {
         return autoDetectPadding(isPartOfSeries, directory, [](auto &&...) {});
     }
+
+    /*
+     * Sidecar metadata index for file-based iteration encoding, e.g.
+     * `data_%T.h5.index.json` next to `data_000100.h5`.
+     * It caches the outcome of scanning the directory for files of the Series
+     * (file names, iteration indexes and padding) and, for iterations that
+     * have been parsed by a reader using the index, their hierarchy
+     * (see internal::MetadataCache).
+     * The iteration list is used as long as the names in the directory are
+     * unchanged, the hierarchy of an iteration as long as the size and
+     * modification time of its file are unchanged.
+     */
+    constexpr int metadataIndexFormat = 2;
+
+    struct MetadataIndex
+    {
+        int padding = -1;
+        std::vector<std::pair<Series::IterationIndex_t, std::string>> files;
+        std::map<std::string, internal::MetadataCache::CachedIteration>
+            hierarchy;
+    };
+
+    std::string metadataIndexFilename(internal::SeriesData const &series)
+    {
+        return series.m_name + series.m_filenameExtension + ".index.json";
+    }
+
+    /*
+     * Fingerprint of the names in a directory, apart from the index itself
+     * (FNV-1a). Unlike modification times, it does not depend on the
+     * timestamp granularity of the filesystem.
+     */
+    std::uint64_t listingHash(
+        std::vector<std::string> entries, std::string const &indexFilename)
+    {
+        std::sort(entries.begin(), entries.end());
+        std::uint64_t hash = 14695981039346656037ull;
+        for (auto const &entry : entries)
+        {
+            if (entry == indexFilename)
+            {
+                continue;
+            }
+            // include the terminating null byte as separator
+            for (size_t i = 0; i <= entry.size(); ++i)
+            {
+                hash ^= static_cast<unsigned char>(entry.c_str()[i]);
+                hash *= 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    bool isMetadataIndexWriter([[maybe_unused]] internal::SeriesData &series)
+    {
+#if openPMD_HAVE_MPI
+        if (series.m_communicator.has_value())
+        {
+            int rank = 0;
+            MPI_Comm_rank(series.m_communicator.value(), &rank);
+            return rank == 0;
+        }
+#endif
+        return true;
+    }
+
+    // see internal::MetadataCache::isCacheable()
+    template <typename T>
+    constexpr bool storableAsJson()
+    {
+        if constexpr (auxiliary::IsVector_v<T>)
+        {
+            return storableAsJson<typename T::value_type>();
+        }
+        else
+        {
+            return !std::is_same_v<T, long double> &&
+                !auxiliary::IsComplex_v<T>;
+        }
+    }
+
+    struct DecodeCachedAttribute
+    {
+        template <typename T>
+        static Attribute::resource call(nlohmann::json const &value)
+        {
+            if constexpr (!storableAsJson<T>())
+            {
+                throw std::runtime_error(
+                    "Attribute datatype cannot be cached.");
+            }
+            else
+            {
+                return value.get<T>();
+            }
+        }
+
+        static constexpr char const *errorMsg = "Metadata index";
+    };
+
+    nlohmann::json encodeCachedAttribute(Attribute::resource const &resource)
+    {
+        return std::visit(
+            [](auto const &value) -> nlohmann::json {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (!storableAsJson<T>())
+                {
+                    // filtered by MetadataCache::isCacheable()
+                    return nullptr;
+                }
+                else
+                {
+                    return value;
+                }
+            },
+            resource);
+    }
+
+    nlohmann::json
+    encodeCachedObjects(internal::MetadataCache::CachedIteration const &it)
+    {
+        nlohmann::json res = nlohmann::json::object();
+        for (auto const &[path, object] : it.objects)
+        {
+            auto &encoded = res[path] = nlohmann::json::object();
+            if (object.attributeNames.has_value())
+            {
+                encoded["attribute_names"] = *object.attributeNames;
+            }
+            if (object.paths.has_value())
+            {
+                encoded["paths"] = *object.paths;
+            }
+            if (object.datasets.has_value())
+            {
+                encoded["datasets"] = *object.datasets;
+            }
+            auto &attributes = encoded["attributes"] = nlohmann::json::object();
+            for (auto const &[name, attribute] : object.attributes)
+            {
+                attributes[name] = {
+                    {"datatype", datatypeToString(attribute.first)},
+                    {"value", encodeCachedAttribute(attribute.second)}};
+            }
+        }
+        return res;
+    }
+
+    internal::MetadataCache::CachedIteration
+    decodeCachedIteration(nlohmann::json const &entry)
+    {
+        internal::MetadataCache::CachedIteration res;
+        res.state = internal::MetadataCache::CachedIteration::State::Unchecked;
+        res.filename = entry.at("file").get<std::string>();
+        res.size = entry.at("size").get<std::uint64_t>();
+        res.modificationTime = entry.at("mtime").get<std::int64_t>();
+        for (auto const &[path, encoded] : entry.at("objects").items())
+        {
+            auto &object = res.objects[path];
+            auto readList = [&encoded = encoded](
+                                char const *key, auto &cachedList) {
+                if (auto it = encoded.find(key); it != encoded.end())
+                {
+                    cachedList = it->template get<std::vector<std::string>>();
+                }
+            };
+            readList("attribute_names", object.attributeNames);
+            readList("paths", object.paths);
+            readList("datasets", object.datasets);
+            for (auto const &[name, attribute] :
+                 encoded.at("attributes").items())
+            {
+                auto dtype = stringToDatatype(
+                    attribute.at("datatype").get<std::string>());
+                object.attributes.emplace(
+                    name,
+                    std::make_pair(
+                        dtype,
+                        switchType<DecodeCachedAttribute>(
+                            dtype, attribute.at("value"))));
+            }
+        }
+        return res;
+    }
+
+    /*
+     * Return the index if it exists and is up to date, an empty optional
+     * otherwise.
+     * Costs reading the index and listing the directory once, the files of
+     * the Series are only checked upon parsing them.
+     */
+    std::optional<MetadataIndex> readMetadataIndex(
+        std::string const &directory, internal::SeriesData const &series)
+    {
+        auto indexFilename = metadataIndexFilename(series);
+        std::ifstream file(directory + indexFilename);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+        MetadataIndex res;
+        try
+        {
+            auto index = nlohmann::json::parse(file);
+            if (index.at("format").get<int>() != metadataIndexFormat ||
+                index.at("directory_listing").get<std::uint64_t>() !=
+                    listingHash(
+                        auxiliary::list_directory(directory), indexFilename))
+            {
+                return std::nullopt;
+            }
+            res.padding = index.at("padding").get<int>();
+            for (auto const &[key, entry] : index.at("iterations").items())
+            {
+                res.files.emplace_back(
+                    std::stoull(key), entry.at("file").get<std::string>());
+                if (entry.contains("objects"))
+                {
+                    res.hierarchy.emplace(key, decodeCachedIteration(entry));
+                }
+            }
+        }
+        catch (std::exception const &)
+        {
+            // unreadable or outdated format, fall back to scanning
+            return std::nullopt;
+        }
+        return res;
+    }
+
+    /*
+     * Scan the directory and store the result as metadata index, along with
+     * the cached hierarchy of iterations whose files are unchanged.
+     * Errors are reported as warnings, the index is only an optimization.
+     */
+    void writeMetadataIndex(
+        std::string const &directory,
+        internal::SeriesData const &series,
+        internal::MetadataCache const *cache)
+    {
+        auto indexFilename = metadataIndexFilename(series);
+        auto path = directory + indexFilename;
+        auto entries = auxiliary::list_directory(directory);
+        nlohmann::json index;
+        index["format"] = metadataIndexFormat;
+        index["directory_listing"] = listingHash(entries, indexFilename);
+        auto &iterations = index["iterations"] = nlohmann::json::object();
+        int padding = autoDetectPadding(
+            matcher(
+                series.m_filenamePrefix,
+                series.m_filenamePadding,
+                series.m_filenamePostfix,
+                series.m_filenameExtension),
+            entries,
+            [&](std::string const &filename, Match const &match) {
+                auto key = std::to_string(match.iteration);
+                auto &entry = iterations[key] = {{"file", filename}};
+                if (!cache)
+                {
+                    return;
+                }
+                auto cached = cache->iterations.find(key);
+                if (cached == cache->iterations.end() ||
+                    cached->second.objects.empty())
+                {
+                    return;
+                }
+                auto const &it = cached->second;
+                using State =
+                    internal::MetadataCache::CachedIteration::State;
+                if (it.state == State::Recording)
+                {
+                    // recorded in this session, from the current file
+                    auto fileStatus =
+                        auxiliary::file_status(directory + filename);
+                    if (!fileStatus.has_value())
+                    {
+                        return;
+                    }
+                    entry["size"] = fileStatus->size;
+                    entry["mtime"] = fileStatus->modificationTime;
+                }
+                else if (it.filename == filename)
+                {
+                    // taken over from the previous index
+                    entry["size"] = it.size;
+                    entry["mtime"] = it.modificationTime;
+                }
+                else
+                {
+                    return;
+                }
+                entry["objects"] = encodeCachedObjects(it);
+            });
+        index["padding"] = padding;
+
+        std::ofstream file(path, std::ios_base::out | std::ios_base::trunc);
+        file << index.dump() << '\n';
+        file.close();
+        if (!file)
+        {
+            std::cerr << "[Warning] Cannot write metadata index to '" << path
+                      << "'." << std::endl;
+        }
+    }
 } // namespace
 
 template <typename... MPI_Communicator>
@@ -1204,6 +1550,10 @@ Given file pattern: ')END"
         break;
     }
     }
+    if (input->asyncFlushThreads > 0)
+    {
+        IOHandler()->enableAsyncFlush();
+    }
     IOHandler()->m_lastFlushSuccessful = true;
 }
 
@@ -1251,6 +1601,10 @@ std::future<void> Series::flush_impl(
     IOHandler()->m_lastFlushSuccessful = true;
     try
     {
+        // The frontend must not inspect the object model while a previous
+        // flush is still running in the background.
+        IOHandler()->awaitPendingFlush();
+        evictClosedIterations();
         switch (iterationEncoding())
         {
             using IE = IterationEncoding;
@@ -1295,13 +1649,18 @@ void Series::flushFileBased(
     if (end == begin)
         throw std::runtime_error(
             "fileBased output can not be written with no iterations.");
+    auto const from = skipFinishedIterations(begin, end);
 
     switch (IOHandler()->m_frontendAccess)
     {
     case Access::READ_ONLY:
     case Access::READ_LINEAR:
-        for (auto it = begin; it != end; ++it)
+        for (auto it = from; it != end; ++it)
         {
+            if (flushIsNoop(it->second))
+            {
+                continue;
+            }
             // Phase 1
             switch (openIterationIfDirty(it->first, it->second))
             {
@@ -1328,6 +1687,7 @@ void Series::flushFileBased(
                     internal::CloseStatus::ClosedInBackend;
             }
         }
+        updateFinishedIterations(begin, end, from);
 
         // Phase 3
         if (flushIOHandler)
@@ -1339,8 +1699,12 @@ void Series::flushFileBased(
     case Access::CREATE:
     case Access::APPEND: {
         bool allDirty = dirty();
-        for (auto it = begin; it != end; ++it)
+        for (auto it = from; it != end; ++it)
         {
+            if (flushIsNoop(it->second))
+            {
+                continue;
+            }
             // Phase 1
             switch (openIterationIfDirty(it->first, it->second))
             {
@@ -1386,6 +1750,7 @@ void Series::flushFileBased(
                 IOHandler()->enqueue(IOTask(&it->second, std::move(fClose)));
                 it->second.get().m_closed =
                     internal::CloseStatus::ClosedInBackend;
+                iterationClosedInBackend(it->first);
             }
             /* reset the dirty bit for every iteration (i.e. file)
              * otherwise only the first iteration will have updates attributes
@@ -1393,6 +1758,7 @@ void Series::flushFileBased(
             setDirty(allDirty);
         }
         setDirty(false);
+        updateFinishedIterations(begin, end, from);
 
         // Phase 3
         if (flushIOHandler)
@@ -1414,8 +1780,13 @@ void Series::flushGorVBased(
 
     if (access::readOnly(IOHandler()->m_frontendAccess))
     {
-        for (auto it = begin; it != end; ++it)
+        auto const from = skipFinishedIterations(begin, end);
+        for (auto it = from; it != end; ++it)
         {
+            if (flushIsNoop(it->second))
+            {
+                continue;
+            }
             // Phase 1
             switch (openIterationIfDirty(it->first, it->second))
             {
@@ -1440,6 +1811,7 @@ void Series::flushGorVBased(
                     internal::CloseStatus::ClosedInBackend;
             }
         }
+        updateFinishedIterations(begin, end, from);
 
         // Phase 3
         Parameter<Operation::TOUCH> touch;
@@ -1480,8 +1852,13 @@ void Series::flushGorVBased(
         series.iterations.flush(
             auxiliary::replace_first(basePath(), "%T/", ""), flushParams);
 
-        for (auto it = begin; it != end; ++it)
+        auto const from = skipFinishedIterations(begin, end);
+        for (auto it = from; it != end; ++it)
         {
+            if (flushIsNoop(it->second))
+            {
+                continue;
+            }
             // Phase 1
             switch (openIterationIfDirty(it->first, it->second))
             {
@@ -1517,8 +1894,10 @@ void Series::flushGorVBased(
                 // the iteration has no dedicated file in group-based mode
                 it->second.get().m_closed =
                     internal::CloseStatus::ClosedInBackend;
+                iterationClosedInBackend(it->first);
             }
         }
+        updateFinishedIterations(begin, end, from);
 
         flushAttributes(flushParams);
         Parameter<Operation::TOUCH> touch;
@@ -1576,19 +1955,63 @@ void Series::readFileBased()
         series.m_filenamePostfix,
         series.m_filenameExtension);
 
-    int padding = autoDetectPadding(
-        isPartOfSeries,
-        IOHandler()->directory,
-        // foreach found file with `filename` and `index`:
-        [&series](std::string const &filename, Match const &match) {
-            auto index = match.iteration;
-            Iteration &i = series.iterations[index];
-            i.deferParseAccess(
-                {std::to_string(index),
-                 index,
-                 true,
-                 cleanFilename(filename, series.m_filenameExtension).body});
-        });
+    auto registerIteration = [&series](
+                                 IterationIndex_t index,
+                                 std::string const &filename) {
+        Iteration &i = series.iterations[index];
+        i.deferParseAccess(
+            {std::to_string(index),
+             index,
+             true,
+             cleanFilename(filename, series.m_filenameExtension).body});
+    };
+
+    std::optional<MetadataIndex> metadataIndex;
+    if (series.m_useMetadataIndex)
+    {
+        metadataIndex = readMetadataIndex(IOHandler()->directory, series);
+    }
+
+    int padding;
+    if (metadataIndex.has_value())
+    {
+        for (auto const &[index, filename] : metadataIndex->files)
+        {
+            registerIteration(index, filename);
+        }
+        padding = metadataIndex->padding;
+    }
+    else
+    {
+        padding = autoDetectPadding(
+            isPartOfSeries,
+            IOHandler()->directory,
+            // foreach found file with `filename` and `index`:
+            [&registerIteration](
+                std::string const &filename, Match const &match) {
+                registerIteration(match.iteration, filename);
+            });
+    }
+    /*
+     * Readers serve metadata reads from the hierarchy cached in the index
+     * and record the rest, the index is rewritten upon closing if that
+     * added anything.
+     */
+    if (series.m_useMetadataIndex &&
+        access::readOnly(IOHandler()->m_backendAccess))
+    {
+        auto cache = std::make_shared<internal::MetadataCache>();
+        cache->directory = IOHandler()->directory;
+        if (metadataIndex.has_value())
+        {
+            cache->iterations = std::move(metadataIndex->hierarchy);
+        }
+        else
+        {
+            cache->changed = true;
+        }
+        IOHandler()->m_metadataCache = std::move(cache);
+    }
 
     if (series.iterations.empty())
     {
@@ -1685,8 +2108,36 @@ void Series::readFileBased()
     {
         bool atLeastOneIterationSuccessful = false;
         std::optional<error::ReadError> forwardFirstError;
-        for (auto &iteration : series.iterations)
+        /*
+         * The frontend parses one iteration after another, but the backend
+         * may read the files of the next batch concurrently.
+         * Batches are kept small to bound memory usage.
+         */
+        auto const parsingThreads = series.m_iterationParsingThreads;
+        auto prefetchedUntil = series.iterations.begin();
+        for (auto it = series.iterations.begin();
+             it != series.iterations.end();
+             ++it)
         {
+            if (parsingThreads > 1 && it == prefetchedUntil)
+            {
+                Parameter<Operation::PREFETCH_FILES> prefetch;
+                prefetch.threads = parsingThreads;
+                for (; prefetchedUntil != series.iterations.end() &&
+                     prefetch.names.size() < parsingThreads;
+                     ++prefetchedUntil)
+                {
+                    auto const &deferred =
+                        prefetchedUntil->second.get().m_deferredParseAccess;
+                    if (deferred.has_value())
+                    {
+                        prefetch.names.push_back(deferred->filename);
+                    }
+                }
+                IOHandler()->enqueue(IOTask(this, prefetch));
+                IOHandler()->flush(internal::defaultFlushParams);
+            }
+            auto &iteration = *it;
             if (auto error = readIterationEagerly(iteration.second); error)
             {
                 std::cerr << "Cannot read iteration '" << iteration.first
@@ -2318,6 +2769,24 @@ std::string Series::iterationFilename(IterationIndex_t i)
 Series::iterations_iterator Series::indexOf(Iteration const &iteration)
 {
     auto &series = get();
+    /*
+     * Container::operator[]() stores the key of new elements in their
+     * Writable. Elements inserted otherwise are found by the linear search
+     * below.
+     */
+    auto const &key = iteration.writable().ownKeyWithinParent;
+    IterationIndex_t index{};
+    if (auto [end, ec] =
+            std::from_chars(key.data(), key.data() + key.size(), index);
+        ec == std::errc() && end == key.data() + key.size())
+    {
+        if (auto it = series.iterations.find(index);
+            it != series.iterations.end() &&
+            &it->second.Attributable::get() == &iteration.Attributable::get())
+        {
+            return it;
+        }
+    }
     for (auto it = series.iterations.begin(); it != series.iterations.end();
          ++it)
     {
@@ -2557,6 +3026,117 @@ void Series::flushStep(bool doFlush)
     series.m_wroteAtLeastOneIOStep = true;
 }
 
+void Series::evictClosedIterations()
+{
+    auto &series = get();
+    if (series.m_iterationsToEvict.empty() || !IOHandler()->m_work.empty())
+    {
+        return;
+    }
+    for (auto index : series.m_iterationsToEvict)
+    {
+        auto it = series.iterations.find(index);
+        if (it == series.iterations.end() || !flushIsNoop(it->second))
+        {
+            continue;
+        }
+        /*
+         * Bypass Container::clear(), which would delete the groups in the
+         * backend. Destroying the Writables deregisters them from the
+         * IOHandler.
+         */
+        it->second.meshes.container().clear();
+        it->second.particles.container().clear();
+    }
+    series.m_iterationsToEvict.clear();
+}
+
+void Series::iterationClosedInBackend(IterationIndex_t index)
+{
+    auto &series = get();
+    if (series.m_evictClosedIterations)
+    {
+        series.m_iterationsToEvict.push_back(index);
+    }
+}
+
+bool Series::flushIsNoop(Iteration const &iteration)
+{
+    switch (iteration.get().m_closed)
+    {
+        using CL = internal::CloseStatus;
+    case CL::ParseAccessDeferred:
+        // Series-level changes are handled by openIterationIfDirty()
+        return !dirty();
+    case CL::ClosedInBackend:
+        // a dirty closed iteration is reported by openIterationIfDirty()
+        return !iteration.dirtyRecursive();
+    case CL::Open:
+    case CL::ClosedInFrontend:
+    case CL::ClosedTemporarily:
+        return false;
+    }
+    return false;
+}
+
+auto Series::skipFinishedIterations(
+    iterations_iterator begin, iterations_iterator end) -> iterations_iterator
+{
+    auto &series = get();
+    auto &container = series.iterations.container();
+    if (!series.m_finishedUpTo.has_value() || begin != container.begin() ||
+        end != container.end())
+    {
+        return begin;
+    }
+    auto res = container.upper_bound(*series.m_finishedUpTo);
+    /*
+     * New iterations in the finished range are caught by
+     * traits::GenerationPolicy<Iteration>, this catches iterations inserted
+     * and removed otherwise.
+     */
+    auto const unfinished = static_cast<size_t>(std::distance(res, end));
+    if (container.size() - unfinished != series.m_finishedCount)
+    {
+        series.m_finishedUpTo.reset();
+        return begin;
+    }
+    return res;
+}
+
+void Series::updateFinishedIterations(
+    iterations_iterator begin,
+    iterations_iterator end,
+    iterations_iterator from)
+{
+    auto &series = get();
+    auto &container = series.iterations.container();
+    if (begin != container.begin() || end != container.end())
+    {
+        return;
+    }
+    if (from == begin)
+    {
+        series.m_finishedUpTo.reset();
+        series.m_finishedCount = 0;
+    }
+    for (auto it = from; it != end; ++it)
+    {
+        auto &iteration = it->second;
+        if (iteration.get().m_closed !=
+                internal::CloseStatus::ClosedInBackend ||
+            iteration.dirtyRecursive())
+        {
+            break;
+        }
+        // Attributable::setDirtyRecursive() resets m_finishedUpTo
+        // if the iteration is modified again
+        iteration.writable().skippedByFlush = true;
+        series.m_finishedUpTo = it->first;
+        ++series.m_finishedCount;
+    }
+}
+
 auto Series::openIterationIfDirty(IterationIndex_t index, Iteration iteration)
     -> IterationOpened
 {
@@ -2742,11 +3322,146 @@ void Series::parseJsonOptions(TracingJSON &options, ParsedInput &input)
     auto &series = get();
     getJsonOption<bool>(
         options, "defer_iteration_parsing", series.m_parseLazily);
+    getJsonOption<bool>(
+        options, "evict_closed_iterations", series.m_evictClosedIterations);
+    if (options.json().contains("metadata_index"))
+    {
+        nlohmann::json const &metadataIndex = options["metadata_index"].json();
+        if (!metadataIndex.is_boolean())
+        {
+            throw error::BackendConfigSchema(
+                {"metadata_index"}, "Must be a boolean.");
+        }
+        series.m_useMetadataIndex = metadataIndex.get<bool>();
+    }
     internal::SeriesData::SourceSpecifiedViaJSON rankTableSource;
     if (getJsonOptionLowerCase(options, "rank_table", rankTableSource.value))
     {
         series.m_rankTable.m_rankTableSource = std::move(rankTableSource);
     }
+    if (options.json().contains("iteration_parsing"))
+    {
+        auto parsingConfig = options["iteration_parsing"];
+        if (!parsingConfig.json().is_object())
+        {
+            throw error::BackendConfigSchema(
+                {"iteration_parsing"}, "Must be an object.");
+        }
+        if (parsingConfig.json().contains("threads"))
+        {
+            nlohmann::json const &threads = parsingConfig["threads"].json();
+            if (!threads.is_number_integer() || threads.get<long long>() < 0)
+            {
+                throw error::BackendConfigSchema(
+                    {"iteration_parsing", "threads"},
+                    "Must be a non-negative integer.");
+            }
+            series.m_iterationParsingThreads = threads.get<unsigned>();
+        }
+    }
+    if (options.json().contains("buffer_pool"))
+    {
+        auto poolConfig = options["buffer_pool"];
+        if (!poolConfig.json().is_object())
+        {
+            throw error::BackendConfigSchema(
+                {"buffer_pool"}, "Must be an object.");
+        }
+        if (poolConfig.json().contains("max_bytes"))
+        {
+            nlohmann::json const &maxBytes = poolConfig["max_bytes"].json();
+            if (!maxBytes.is_number_integer() || maxBytes.get<long long>() < 0)
+            {
+                throw error::BackendConfigSchema(
+                    {"buffer_pool", "max_bytes"},
+                    "Must be a non-negative integer.");
+            }
+            series.m_bufferPool.setMaxPooledBytes(
+                maxBytes.get<std::uint64_t>());
+        }
+    }
+    if (options.json().contains("statistics"))
+    {
+        nlohmann::json const &statistics = options["statistics"].json();
+        if (statistics.is_boolean())
+        {
+            series.m_computeStatistics = statistics.get<bool>();
+        }
+        else if (statistics.is_object())
+        {
+            series.m_computeStatistics = true;
+            if (statistics.contains("histogram_bins"))
+            {
+                nlohmann::json const &bins =
+                    options["statistics"]["histogram_bins"].json();
+                if (!bins.is_number_integer() || bins.get<long long>() < 0)
+                {
+                    throw error::BackendConfigSchema(
+                        {"statistics", "histogram_bins"},
+                        "Must be a non-negative integer.");
+                }
+                series.m_statisticsHistogramBins = bins.get<size_t>();
+            }
+        }
+        else
+        {
+            throw error::BackendConfigSchema(
+                {"statistics"}, "Must be a boolean or an object.");
+        }
+    }
+    if (options.json().contains("read_filter"))
+    {
+        nlohmann::json const &readFilter = options["read_filter"].json();
+        if (!readFilter.is_array() ||
+            !std::all_of(
+                readFilter.begin(), readFilter.end(), [](auto const &entry) {
+                    return entry.is_string();
+                }))
+        {
+            throw error::BackendConfigSchema(
+                {"read_filter"}, "Must be an array of strings.");
+        }
+        series.m_readFilter.clear();
+        for (auto const &entry : readFilter)
+        {
+            auto path = auxiliary::removeSlashes(entry.get<std::string>());
+            auto root = path.substr(0, path.find('/'));
+            if (root != "meshes" && root != "particles")
+            {
+                throw error::BackendConfigSchema(
+                    {"read_filter"},
+                    "Entries must start with 'meshes' or 'particles' (found '" +
+                        path + "').");
+            }
+            series.m_readFilter.push_back(std::move(path));
+        }
+    }
+    // async key
+    if (options.json().contains("async"))
+    {
+        auto asyncConfig = options["async"];
+        if (!asyncConfig.json().is_object())
+        {
+            throw error::BackendConfigSchema(
+                {"async"}, "Must be an object.");
+        }
+        if (asyncConfig.json().contains("threads"))
+        {
+            nlohmann::json const &threads = asyncConfig["threads"].json();
+            if (!threads.is_number_integer() || threads.get<long long>() < 0)
+            {
+                throw error::BackendConfigSchema(
+                    {"async", "threads"}, "Must be a non-negative integer.");
+            }
+            input.asyncFlushThreads = threads.get<unsigned>();
+            if (input.asyncFlushThreads > 1)
+            {
+                std::cerr << "[Warning] IO tasks of a Series must be executed "
+                             "in order, will use one IO thread instead of "
+                          << input.asyncFlushThreads << "." << std::endl;
+            }
+        }
+    }
     // backend key
     {
         std::map<std::string, Format> const backendDescriptors{
@@ -2844,6 +3559,22 @@ namespace internal
         }
     }
 
+    bool SeriesData::passesReadFilter(std::string const &path) const
+    {
+        if (m_readFilter.empty())
+        {
+            return true;
+        }
+        return std::any_of(
+            m_readFilter.begin(),
+            m_readFilter.end(),
+            [&path](std::string const &entry) {
+                return entry == path ||
+                    auxiliary::starts_with(path, entry + '/') ||
+                    auxiliary::starts_with(entry, path + '/');
+            });
+    }
+
     void SeriesData::close()
     {
         // WriteIterations gets the first shot at flushing
@@ -2875,6 +3606,23 @@ namespace internal
             {
                 impl.flushStep(/* doFlush = */ true);
             }
+            // The IO handler must not be released while still flushing in the
+            // background.
+            IOHandler->awaitPendingFlush();
+        }
+        std::optional<std::string> metadataIndexDirectory;
+        std::shared_ptr<MetadataCache> metadataCache;
+        if (auto IOHandler = impl.IOHandler(); IOHandler &&
+            IOHandler->m_lastFlushSuccessful && m_useMetadataIndex &&
+            m_iterationEncoding == IterationEncoding::fileBased)
+        {
+            metadataCache = IOHandler->m_metadataCache;
+            // readers only rewrite an outdated or incomplete index
+            if (!access::readOnly(IOHandler->m_backendAccess) ||
+                (metadataCache && metadataCache->changed))
+            {
+                metadataIndexDirectory = IOHandler->directory;
+            }
         }
         // Not strictly necessary, but clear the map of iterations
         // This releases the openPMD hierarchy
@@ -2884,6 +3632,13 @@ namespace internal
         {
             *m_writable.IOHandler = std::nullopt;
         }
+        // Files are closed now, so their sizes and modification times are
+        // final.
+        if (metadataIndexDirectory.has_value() && isMetadataIndexWriter(*this))
+        {
+            writeMetadataIndex(
+                *metadataIndexDirectory, *this, metadataCache.get());
+        }
     }
 } // namespace internal
 
@@ -2918,14 +3673,45 @@ Series::operator bool() const
     return m_attri.operator bool();
 }
 
-ReadIterations Series::readIterations()
+ReadIterations Series::readIterations(std::string const &options)
 {
+    unsigned prefetch = 0;
+    std::uint64_t prefetchMaxBytes = 64 * 1024 * 1024;
+    auto config = json::parseOptions(options, /* considerFiles = */ false);
+    // TOML integers are signed
+    auto isNonNegativeInteger = [](nlohmann::json const &value) {
+        return value.is_number_integer() && value.get<long long>() >= 0;
+    };
+    if (config.config.contains("prefetch"))
+    {
+        auto const &value = config.config.at("prefetch");
+        if (!isNonNegativeInteger(value))
+        {
+            throw error::BackendConfigSchema(
+                {"prefetch"}, "Must be a non-negative integer.");
+        }
+        prefetch = value.get<unsigned>();
+    }
+    if (config.config.contains("prefetch_max_bytes"))
+    {
+        auto const &value = config.config.at("prefetch_max_bytes");
+        if (!isNonNegativeInteger(value))
+        {
+            throw error::BackendConfigSchema(
+                {"prefetch_max_bytes"}, "Must be a non-negative integer.");
+        }
+        prefetchMaxBytes = value.get<std::uint64_t>();
+    }
     // Use private constructor instead of copy constructor to avoid
     // object slicing
     Series res;
     res.setData(std::dynamic_pointer_cast<internal::SeriesData>(this->m_attri));
     return ReadIterations{
-        std::move(res), IOHandler()->m_frontendAccess, get().m_parsePreference};
+        std::move(res),
+        IOHandler()->m_frontendAccess,
+        get().m_parsePreference,
+        prefetch,
+        prefetchMaxBytes};
 }
 
 void Series::parseBase()
@@ -0,0 +1,136 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/auxiliary/BufferPool.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace openPMD::auxiliary
+{
+namespace
+{
+    constexpr std::size_t minimumSizeClass = 64;
+
+    std::size_t sizeClassOf(std::size_t bytes)
+    {
+        std::size_t res = minimumSizeClass;
+        while (res < bytes)
+        {
+            res *= 2;
+        }
+        return res;
+    }
+} // namespace
+
+struct BufferPool::Data
+{
+    mutable std::mutex mutex;
+    std::uint64_t maxPooledBytes = 0;
+    BufferPoolStatistics statistics;
+    std::unordered_map<std::size_t, std::vector<std::unique_ptr<std::byte[]>>>
+        freeBuffers;
+
+    void release(std::byte *buffer, std::size_t sizeClass)
+    {
+        std::unique_ptr<std::byte[]> owned{buffer};
+        std::lock_guard lock{mutex};
+        if (statistics.pooledBytes + sizeClass > maxPooledBytes)
+        {
+            ++statistics.discards;
+            return;
+        }
+        freeBuffers[sizeClass].push_back(std::move(owned));
+        statistics.pooledBytes += sizeClass;
+        ++statistics.releases;
+    }
+};
+
+BufferPool::BufferPool(std::uint64_t maxPooledBytes)
+    : m_data{std::make_shared<Data>()}
+{
+    m_data->maxPooledBytes = maxPooledBytes;
+}
+
+std::shared_ptr<void> BufferPool::acquire(std::size_t bytes)
+{
+    std::unique_ptr<std::byte[]> buffer;
+    std::size_t sizeClass = 0;
+    {
+        std::lock_guard lock{m_data->mutex};
+        auto &statistics = m_data->statistics;
+        if (m_data->maxPooledBytes == 0)
+        {
+            sizeClass = bytes == 0 ? 1 : bytes;
+        }
+        else
+        {
+            sizeClass = sizeClassOf(bytes);
+            auto it = m_data->freeBuffers.find(sizeClass);
+            if (it != m_data->freeBuffers.end() && !it->second.empty())
+            {
+                buffer = std::move(it->second.back());
+                it->second.pop_back();
+                statistics.pooledBytes -= sizeClass;
+                ++statistics.reuses;
+            }
+        }
+        if (!buffer)
+        {
+            ++statistics.allocations;
+        }
+    }
+    if (!buffer)
+    {
+        buffer.reset(new std::byte[sizeClass]);
+    }
+    std::weak_ptr<Data> pool = m_data;
+    return std::shared_ptr<void>(
+        buffer.release(), [pool = std::move(pool), sizeClass](void *ptr) {
+            auto raw = static_cast<std::byte *>(ptr);
+            if (auto data = pool.lock(); data)
+            {
+                data->release(raw, sizeClass);
+            }
+            else
+            {
+                delete[] raw;
+            }
+        });
+}
+
+void BufferPool::setMaxPooledBytes(std::uint64_t maxPooledBytes)
+{
+    std::lock_guard lock{m_data->mutex};
+    m_data->maxPooledBytes = maxPooledBytes;
+    if (maxPooledBytes < m_data->statistics.pooledBytes)
+    {
+        m_data->freeBuffers.clear();
+        m_data->statistics.pooledBytes = 0;
+    }
+}
+
+BufferPoolStatistics BufferPool::statistics() const
+{
+    std::lock_guard lock{m_data->mutex};
+    return m_data->statistics;
+}
+} // namespace openPMD::auxiliary
@@ -27,14 +27,19 @@
 #else
 #include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
 #include <system_error>
+#include <utility>
+#include <vector>
 
 namespace openPMD::auxiliary
 {
@@ -175,6 +180,108 @@ bool remove_file(std::string const &path)
 #endif
 }
 
+std::optional<FileStatus> file_status(std::string const &path)
+{
+    FileStatus res;
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesEx(path.c_str(), GetFileExInfoStandard, &data))
+        return std::nullopt;
+    res.size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32) |
+        data.nFileSizeLow;
+    // FILETIME counts 100 ns intervals
+    res.modificationTime =
+        ((static_cast<std::int64_t>(data.ftLastWriteTime.dwHighDateTime)
+          << 32) |
+         data.ftLastWriteTime.dwLowDateTime) *
+        100;
+#else
+    struct stat s;
+    if (0 != stat(path.c_str(), &s))
+        return std::nullopt;
+    res.size = static_cast<std::uint64_t>(s.st_size);
+#if defined(__APPLE__)
+    auto const &mtime = s.st_mtimespec;
+#else
+    auto const &mtime = s.st_mtim;
+#endif
+    res.modificationTime =
+        static_cast<std::int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec;
+#endif
+    return res;
+}
+
+namespace
+{
+#ifndef _WIN32
+    void collect_files(
+        std::string const &path,
+        std::vector<std::pair<std::uint64_t, std::string>> &files)
+    {
+        if (directory_exists(path))
+        {
+            for (auto const &entry : list_directory(path))
+            {
+                collect_files(path + directory_separator + entry, files);
+            }
+        }
+        else if (auto status = file_status(path); status.has_value())
+        {
+            files.emplace_back(status->size, path);
+        }
+    }
+
+    bool advise_willneed(std::string const &path, std::uint64_t bytes)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+#ifdef POSIX_FADV_WILLNEED
+        bool res = 0 ==
+            posix_fadvise(
+                fd, 0, static_cast<off_t>(bytes), POSIX_FADV_WILLNEED);
+#else
+        (void)bytes;
+        bool res = false;
+#endif
+        ::close(fd);
+        return res;
+    }
+#endif
+} // namespace
+
+std::uint64_t prefetch_file(std::string const &path, std::uint64_t maxBytes)
+{
+#ifdef _WIN32
+    (void)path;
+    (void)maxBytes;
+    return 0;
+#else
+    std::vector<std::pair<std::uint64_t, std::string>> files;
+    collect_files(path, files);
+    /*
+     * Smallest files first: in ADIOS2 BP directories, these are the metadata
+     * and index files needed for opening the iteration.
+     */
+    std::sort(files.begin(), files.end());
+    std::uint64_t res = 0;
+    for (auto const &[size, file] : files)
+    {
+        // a length of 0 would advise the whole file
+        auto bytes = std::min(size, maxBytes - res);
+        if (bytes == 0)
+        {
+            continue;
+        }
+        if (advise_willneed(file, bytes))
+        {
+            res += bytes;
+        }
+    }
+    return res;
+#endif
+}
+
 #if openPMD_HAVE_MPI
 
 std::string collective_file_read(std::string const &path, MPI_Comm comm)
@@ -0,0 +1,118 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/auxiliary/InternedString.hpp"
+
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+namespace openPMD::auxiliary
+{
+namespace
+{
+    struct Table
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string_view, std::weak_ptr<std::string const>>
+            entries;
+    };
+
+    /*
+     * Never destroyed, so handles in static objects stay valid until the
+     * end of the program.
+     */
+    Table &table()
+    {
+        static Table *res = new Table;
+        return *res;
+    }
+
+    void release(std::string const *str)
+    {
+        {
+            auto &t = table();
+            std::lock_guard lock{t.mutex};
+            /*
+             * Between the last handle going away and this point, another
+             * thread may have replaced the expired entry with a new string
+             * of equal content. Only remove the entry if it is still ours.
+             */
+            auto it = t.entries.find(*str);
+            if (it != t.entries.end() && it->first.data() == str->data())
+            {
+                t.entries.erase(it);
+            }
+        }
+        delete str;
+    }
+
+    std::shared_ptr<std::string const> intern(std::string_view s)
+    {
+        if (s.empty())
+        {
+            return nullptr;
+        }
+        auto &t = table();
+        std::lock_guard lock{t.mutex};
+        if (auto it = t.entries.find(s); it != t.entries.end())
+        {
+            if (auto res = it->second.lock(); res)
+            {
+                return res;
+            }
+            t.entries.erase(it);
+        }
+        auto owned = new std::string(s);
+        std::shared_ptr<std::string const> res{owned, &release};
+        t.entries.emplace(std::string_view(*owned), res);
+        return res;
+    }
+} // namespace
+
+InternedString::InternedString(std::string_view s) : m_entry(intern(s))
+{}
+
+InternedString::InternedString(std::string const &s)
+    : m_entry(intern(std::string_view(s)))
+{}
+
+InternedString::InternedString(char const *s)
+    : m_entry(intern(std::string_view(s)))
+{}
+
+std::string const &InternedString::str() const
+{
+    static std::string const empty;
+    return m_entry ? *m_entry : empty;
+}
+
+std::size_t InternedString::tableSize()
+{
+    auto &t = table();
+    std::lock_guard lock{t.mutex};
+    return t.entries.size();
+}
+
+std::ostream &operator<<(std::ostream &os, InternedString const &s)
+{
+    return os << s.str();
+}
+} // namespace openPMD::auxiliary
@@ -214,6 +214,22 @@ std::string Attributable::MyPath::openPMDPath() const
     }
 }
 
+void Attributable::stopSkippingInFlush(Writable &iteration)
+{
+    iteration.skippedByFlush = false;
+    // Iteration -> Series::iterations -> Series
+    if (!iteration.parent || !iteration.parent->parent)
+    {
+        return;
+    }
+    if (auto series = dynamic_cast<internal::SeriesData *>(
+            iteration.parent->parent->attributable);
+        series)
+    {
+        series->m_finishedUpTo.reset();
+    }
+}
+
 auto Attributable::myPath() const -> MyPath
 {
     MyPath res;
@@ -224,7 +240,7 @@ auto Attributable::myPath() const -> MyPath
         // so it's alright that this loop doesn't ask the key of the last found
         // Writable
 
-        res.group.push_back(findSeries->ownKeyWithinParent);
+        res.group.push_back(findSeries->ownKeyWithinParent.str());
         findSeries = findSeries->parent;
     }
     std::reverse(res.group.begin(), res.group.end());
@@ -484,6 +500,15 @@ void Attributable::readAttributes(ReadMode mode)
     setDirty(false);
 }
 
+void Attributable::awaitBackendUpdates() const
+{
+    auto handler = const_cast<AbstractIOHandler *>(IOHandler());
+    if (handler)
+    {
+        handler->awaitPendingFlush();
+    }
+}
+
 void Attributable::setWritten(bool val, EnqueueAsynchronously ea)
 {
     switch (ea)
@@ -496,6 +521,7 @@ void Attributable::setWritten(bool val, EnqueueAsynchronously ea)
     }
     break;
     case EnqueueAsynchronously::No:
+        awaitBackendUpdates();
         break;
     }
     writable().written = val;
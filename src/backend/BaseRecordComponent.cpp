@@ -22,6 +22,8 @@
 #include "openPMD/Error.hpp"
 #include "openPMD/Iteration.hpp"
 
+#include <algorithm>
+
 namespace openPMD
 {
 double BaseRecordComponent::unitSI() const
@@ -109,6 +111,34 @@ ChunkTable BaseRecordComponent::availableChunks()
     return std::move(*param.chunks);
 }
 
+ChunkTable BaseRecordComponent::availableChunks(
+    std::function<bool(double, double)> const &filter)
+{
+    auto table = availableChunks();
+    // bounds of the whole component if written with the statistics option
+    std::optional<std::pair<double, double>> componentBounds;
+    if (containsAttribute("statisticsMin") &&
+        containsAttribute("statisticsMax"))
+    {
+        componentBounds = std::make_pair(
+            getAttribute("statisticsMin").get<double>(),
+            getAttribute("statisticsMax").get<double>());
+    }
+    table.erase(
+        std::remove_if(
+            table.begin(),
+            table.end(),
+            [&](WrittenChunkInfo const &chunk) {
+                auto const &bounds = chunk.valueBounds.has_value()
+                    ? chunk.valueBounds
+                    : componentBounds;
+                return bounds.has_value() &&
+                    !filter(bounds->first, bounds->second);
+            }),
+        table.end());
+    return table;
+}
+
 BaseRecordComponent::BaseRecordComponent() : Attributable(NoInit())
 {
     setData(std::make_shared<Data_t>());
@@ -22,6 +22,9 @@
 #include "openPMD/Series.hpp"
 #include "openPMD/auxiliary/DerefDynamicCast.hpp"
 
+#include <exception>
+#include <iostream>
+
 namespace openPMD
 {
 Writable::Writable(internal::AttributableData *a) : attributable{a}
@@ -38,8 +41,23 @@ Writable::~Writable()
      * The DEREGISTER task must not dereference the pointer, but only use it to
      * remove references to this object from internal data structures.
      */
-    IOHandler->value()->enqueue(
-        IOTask(this, Parameter<Operation::DEREGISTER>(parent)));
+    try
+    {
+        IOHandler->value()->enqueue(
+            IOTask(this, Parameter<Operation::DEREGISTER>(parent)));
+    }
+    catch (std::exception const &ex)
+    {
+        // Enqueueing waits for a running background flush, which might fail.
+        // We must not throw in a destructor.
+        std::cerr << "[~Writable] An error occurred in a background flush: "
+                  << ex.what() << std::endl;
+    }
+    catch (...)
+    {
+        std::cerr << "[~Writable] An error occurred in a background flush."
+                  << std::endl;
+    }
 }
 
 void Writable::seriesFlush(std::string backendConfig)
@@ -151,6 +151,13 @@ not possible once it has been closed.
             // keep handle alive while iterator exists
             py::keep_alive<0, 1>());
 
+    py::class_<FlushConfig>(m, "FlushConfig", R"END(
+Backend configuration for Series.flush(), parsed ahead of time.
+
+Create instance via Series.prepare_flush_config() and pass it to
+Series.flush() as often as needed.
+    )END");
+
     // `clang-format on/off` doesn't help here.
     // Writing this without a macro would lead to a huge diff due to
     // clang-format.
@@ -320,7 +327,18 @@ this method.
             &Series::iterationFormat,
             &Series::setIterationFormat)
         .def_property("name", &Series::name, &Series::setName)
-        .def("flush", &Series::flush, py::arg("backend_config") = "{}")
+        .def(
+            "flush",
+            py::overload_cast<std::string>(&Series::flush),
+            py::arg("backend_config") = "{}")
+        .def(
+            "flush",
+            py::overload_cast<FlushConfig const &>(&Series::flush),
+            py::arg("backend_config"))
+        .def(
+            "prepare_flush_config",
+            &Series::prepareFlushConfig,
+            py::arg("backend_config"))
 
         .def_property_readonly(
             "backend", static_cast<std::string (Series::*)()>(&Series::backend))
@@ -345,10 +363,11 @@ this method.
             py::keep_alive<1, 0>())
         .def(
             "read_iterations",
-            [](Series &s) {
+            [](Series &s, std::string const &options) {
                 py::gil_scoped_release release;
-                return s.readIterations();
+                return s.readIterations(options);
             },
+            py::arg("options") = "{}",
             py::keep_alive<0, 1>(),
             R"END(
 Entry point to the reading end of the streaming API.
@@ -362,6 +381,11 @@ iteration cannot be opened again once it has been closed.
 For a less restrictive API in non-streaming situations,
 `Series.iterations` can be accessed directly.
 Look for the ReadIterations class for further documentation.
+The key `prefetch` in the JSON/TOML `options` specifies how many upcoming
+iterations of a file-based Series are prefetched into the page cache of the
+operating system while the current one is processed, e.g. '{"prefetch": 2}'.
+The key `prefetch_max_bytes` limits the bytes prefetched per iteration
+(default: 64 MiB).
             )END")
         .def(
             "parse_base",
@@ -8,6 +8,7 @@
 #include "openPMD/IO/AbstractIOHandlerHelper.hpp"
 #include "openPMD/auxiliary/DerefDynamicCast.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/InternedString.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/backend/Attributable.hpp"
@@ -22,6 +23,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -406,6 +408,7 @@ TEST_CASE("filesystem_test", "[auxiliary]")
     using auxiliary::file_exists;
     using auxiliary::directory_exists;
     using auxiliary::list_directory;
+    using auxiliary::prefetch_file;
     using auxiliary::remove_directory;
     using auxiliary::remove_file;
 
@@ -472,6 +475,12 @@ TEST_CASE("filesystem_test", "[auxiliary]")
 
     REQUIRE(file_exists("./AuxiliaryTests"));
     REQUIRE(!file_exists("./nonexistent_file_in_cmake_bin_directory"));
+#ifdef __linux__
+    REQUIRE(prefetch_file("./AuxiliaryTests", 1024) == 1024);
+    REQUIRE(prefetch_file("../bin", 4096) == 4096);
+#endif
+    REQUIRE(
+        prefetch_file("./nonexistent_file_in_cmake_bin_directory", 1024) == 0);
 
     auto dir_entries = list_directory("/");
     REQUIRE(!dir_entries.empty());
@@ -508,3 +517,33 @@ TEST_CASE("filesystem_test", "[auxiliary]")
     REQUIRE(!remove_file("./nonexistent_file_in_cmake_bin_directory"));
 #endif
 }
+
+TEST_CASE("interned_string_test", "[auxiliary]")
+{
+    using auxiliary::InternedString;
+
+    auto const initialSize = InternedString::tableSize();
+    {
+        std::string const key = "position";
+        InternedString a = key;
+        InternedString b = "position";
+        InternedString c = std::string_view("momentum");
+        REQUIRE(a == b);
+        REQUIRE(a.data() == b.data());
+        REQUIRE(a != c);
+        REQUIRE(a.hash() == b.hash());
+        REQUIRE(a.str() == "position");
+        REQUIRE(InternedString::tableSize() == initialSize + 2);
+
+        InternedString empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty == InternedString(""));
+        REQUIRE(empty.str().empty());
+        REQUIRE(InternedString::tableSize() == initialSize + 2);
+
+        std::unordered_set<InternedString> set{a, b, c};
+        REQUIRE(set.size() == 2);
+    }
+    // entries leave the table together with their last handle
+    REQUIRE(InternedString::tableSize() == initialSize);
+}
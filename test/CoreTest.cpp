@@ -8,9 +8,11 @@
 #include "openPMD/openPMD.hpp"
 
 #include "openPMD/IO/ADIOS/macros.hpp"
+#include "openPMD/auxiliary/BufferPool.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/JSON.hpp"
 #include "openPMD/auxiliary/UniquePtr.hpp"
+#include "openPMD/backend/AttributeMap.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -1524,3 +1526,188 @@ TEST_CASE("scalar_and_vector", "[core]")
         REQUIRE(!E.contains("x"));
     }
 }
+
+TEST_CASE("chunk_assignment", "[core]")
+{
+    using namespace chunk_assignment;
+    auto totalVolume = [](Assignment const &assignment) {
+        Extent::value_type res = 0;
+        for (auto const &rankChunks : assignment)
+        {
+            for (auto const &chunk : rankChunks.second)
+            {
+                Extent::value_type volume = 1;
+                for (auto ext : chunk.extent)
+                {
+                    volume *= ext;
+                }
+                res += volume;
+            }
+        }
+        return res;
+    };
+
+    // four writers on two hosts, each wrote 10 rows of a 40x5 dataset
+    ChunkTable table;
+    for (unsigned writer = 0; writer < 4; ++writer)
+    {
+        table.emplace_back(Offset{writer * 10, 0}, Extent{10, 5}, writer);
+    }
+    RankMeta writers{{0, "node0"}, {1, "node0"}, {2, "node1"}, {3, "node1"}};
+    RankMeta readers{{0, "node0"}, {1, "node1"}, {2, "node2"}};
+
+    {
+        auto assignment = RoundRobin().assign(table, writers, readers);
+        REQUIRE(assignment.at(0).size() == 2);
+        REQUIRE(assignment.at(1).size() == 1);
+        REQUIRE(assignment.at(2).size() == 1);
+        REQUIRE(bool(assignment.at(0)[1] == table[3]));
+    }
+
+    {
+        // node2 has no data of its own, so it gets nothing from ByHostname
+        auto partial = ByHostname(std::make_unique<RoundRobin>())
+                           .assign(table, writers, readers);
+        REQUIRE(partial.notAssigned.empty());
+        REQUIRE(partial.assigned.at(0).size() == 2);
+        REQUIRE(partial.assigned.at(1).size() == 2);
+        REQUIRE(partial.assigned.find(2) == partial.assigned.end());
+        for (auto const &chunk : partial.assigned.at(1))
+        {
+            REQUIRE(writers.at(chunk.sourceID) == "node1");
+        }
+
+        // readers only on node1 and node2, node0 data goes to the fallback
+        RankMeta otherReaders{{0, "node1"}, {1, "node2"}};
+        FromPartialStrategy composed(
+            std::make_unique<ByHostname>(std::make_unique<RoundRobin>()),
+            std::make_unique<BinPacking>());
+        auto assignment =
+            composed.clone()->assign(table, writers, otherReaders);
+        REQUIRE(totalVolume(assignment) == 200);
+        REQUIRE(assignment.at(0).size() >= 2);
+
+        FromPartialStrategy strict(
+            std::make_unique<ByHostname>(std::make_unique<RoundRobin>()),
+            std::make_unique<FailingStrategy>());
+        REQUIRE_THROWS_AS(
+            strict.assign(table, writers, otherReaders), std::runtime_error);
+    }
+
+    {
+        // 200 elements over 3 ranks, chunks get split along dimension 0
+        auto assignment = BinPacking().assign(table, writers, readers);
+        REQUIRE(totalVolume(assignment) == 200);
+        for (auto const &rankChunks : assignment)
+        {
+            Assignment single{rankChunks};
+            REQUIRE(totalVolume(single) <= 70);
+            REQUIRE(totalVolume(single) >= 60);
+        }
+    }
+
+    {
+        ByCuboidSlice slice(
+            std::make_unique<OneDimensionalBlockSlicer>(0), Extent{40, 5});
+        auto assignment = slice.assign(table, writers, readers);
+        REQUIRE(totalVolume(assignment) == 200);
+        // 40 rows over 3 ranks: 14, 13, 13
+        REQUIRE(assignment.at(0).size() == 2);
+        auto const &first = assignment.at(0);
+        auto const &last = assignment.at(2);
+        REQUIRE(bool(first[0] == WrittenChunkInfo({0, 0}, {10, 5})));
+        REQUIRE(bool(first[1] == WrittenChunkInfo({10, 0}, {4, 5}, 1)));
+        REQUIRE(bool(last[0] == WrittenChunkInfo({27, 0}, {3, 5}, 2)));
+        REQUIRE(bool(last[1] == WrittenChunkInfo({30, 0}, {10, 5}, 3)));
+    }
+
+    REQUIRE_THROWS_AS(
+        RoundRobin().assign(table, writers, RankMeta{}), std::runtime_error);
+}
+
+TEST_CASE("buffer_pool", "[core]")
+{
+    using namespace openPMD::auxiliary;
+    BufferPool pool(1024);
+    void *first = nullptr;
+    {
+        auto buffer = pool.acquire(100);
+        first = buffer.get();
+        REQUIRE(pool.statistics().allocations == 1);
+    }
+    // returned into the size class of 128 bytes
+    REQUIRE(pool.statistics().releases == 1);
+    REQUIRE(pool.statistics().pooledBytes == 128);
+    {
+        auto buffer = pool.acquire(120);
+        REQUIRE(buffer.get() == first);
+        auto other = pool.acquire(120);
+        REQUIRE(other.get() != first);
+        auto stats = pool.statistics();
+        REQUIRE(stats.reuses == 1);
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.pooledBytes == 0);
+    }
+    REQUIRE(pool.statistics().pooledBytes == 256);
+
+    // exceeds the limit of pooled bytes
+    pool.acquire(1000);
+    REQUIRE(pool.statistics().discards == 1);
+    REQUIRE(pool.statistics().pooledBytes == 256);
+
+    // buffers may outlive the pool
+    std::shared_ptr<void> survivor;
+    {
+        BufferPool shortLived(1024);
+        survivor = shortLived.acquire(10);
+    }
+    survivor.reset();
+
+    BufferPool disabled;
+    disabled.acquire(10);
+    REQUIRE(disabled.statistics().discards == 1);
+    REQUIRE(disabled.statistics().pooledBytes == 0);
+}
+
+TEST_CASE("attribute_map", "[core]")
+{
+    internal::AttributeMap map;
+    REQUIRE(map.empty());
+    for (std::string key : {"unitSI", "axisLabels", "timeOffset", "position"})
+    {
+        REQUIRE(map.find(key) == map.end());
+        map.emplace_hint(
+            map.lower_bound(key), std::make_pair(key, Attribute(key.size())));
+        REQUIRE(map.find(key) != map.end());
+    }
+    REQUIRE(map.size() == 4);
+    std::vector<std::string> keys;
+    for (auto const &entry : map)
+    {
+        keys.push_back(entry.first);
+    }
+    REQUIRE(
+        keys ==
+        std::vector<std::string>{
+            "axisLabels", "position", "timeOffset", "unitSI"});
+
+    REQUIRE(map.find("unitSI")->second.get<size_t>() == 6);
+    REQUIRE(map.find("unitDimension") == map.end());
+    REQUIRE(map.erase("position") == 1);
+    REQUIRE(map.erase("position") == 0);
+    REQUIRE(map.size() == 3);
+    map.clear();
+    REQUIRE(map.empty());
+
+    // Attributable keeps its attributes sorted
+    Series series("../samples/attribute_map.json", Access::CREATE);
+    auto E = series.iterations[0].meshes["E"];
+    E.setAttribute("zzz", 1);
+    E.setAttribute("aaa", 2);
+    REQUIRE(E.setAttribute("aaa", 3));
+    auto attributes = E.attributes();
+    REQUIRE(std::is_sorted(attributes.begin(), attributes.end()));
+    REQUIRE(E.getAttribute("aaa").get<int>() == 3);
+    REQUIRE(E.deleteAttribute("zzz"));
+    REQUIRE(!E.containsAttribute("zzz"));
+}
@@ -758,6 +758,74 @@ TEST_CASE("write_makeconst_some", "[parallel]")
     }
 }
 
+void record_component_statistics(std::string const &file_ending)
+{
+    int mpi_s{-1};
+    int mpi_r{-1};
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_s);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_r);
+    auto mpi_size = static_cast<uint64_t>(mpi_s);
+    auto mpi_rank = static_cast<uint64_t>(mpi_r);
+    std::string name =
+        "../samples/parallel_record_component_statistics." + file_ending;
+    {
+        Series write(
+            name,
+            Access::CREATE,
+            MPI_COMM_WORLD,
+            R"({"statistics": {"histogram_bins": 2}})");
+        auto it = write.iterations[0];
+        auto E_x = it.meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {mpi_size * 2}});
+        // the last rank contributes nothing
+        std::vector<double> data{double(mpi_rank), double(mpi_rank)};
+        if (mpi_rank + 1 < mpi_size)
+        {
+            E_x.storeChunk(data, {2 * mpi_rank}, {2});
+        }
+        // HDF5 Attribute writes are unfortunately collective
+        std::vector<int> onlyRank0{1, 2, 3};
+        if (mpi_rank == 0 && file_ending != "h5")
+        {
+            auto B_x = it.meshes["B"]["x"];
+            B_x.resetDataset({Datatype::INT, {3}});
+            B_x.storeChunk(onlyRank0, {0}, {3});
+        }
+        it.close();
+    }
+
+    Series read(name, Access::READ_ONLY, MPI_COMM_WORLD);
+    auto it = read.iterations[0];
+    auto E_x = it.meshes["E"]["x"].statistics();
+    // no values at all if the only rank is the last one
+    REQUIRE(E_x.has_value() == (mpi_size > 1));
+    if (mpi_size > 1)
+    {
+        REQUIRE(E_x->count == 2 * (mpi_size - 1));
+        REQUIRE(E_x->min == 0.);
+        REQUIRE(E_x->max == double(mpi_size - 2));
+        REQUIRE(
+            std::accumulate(
+                E_x->histogram.begin(), E_x->histogram.end(), uint64_t(0)) ==
+            2 * (mpi_size - 1));
+    }
+    if (file_ending != "h5")
+    {
+        auto B_x = it.meshes["B"]["x"].statistics();
+        REQUIRE(B_x.has_value());
+        REQUIRE(B_x->count == 3);
+        REQUIRE(B_x->mean == 2.);
+    }
+}
+
+TEST_CASE("record_component_statistics", "[parallel]")
+{
+    for (auto const &t : getBackends())
+    {
+        record_component_statistics(t);
+    }
+}
+
 void close_iteration_test(std::string const &file_ending)
 {
     int i_mpi_rank{-1}, i_mpi_size{-1};
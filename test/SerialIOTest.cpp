@@ -2659,8 +2659,10 @@ TEST_CASE("available_chunks_test_hdf5", "[serial][json]")
 {
     /*
      * This test is HDF5 specific
-     * HDF5 does not store chunks explicitly,
-     * so the HDF5 backend will simply return the whole dataset as one chunk.
+     * HDF5 does not store the written chunks explicitly, but reports the
+     * chunks of its storage layout. For this small dataset, the default
+     * chunking heuristics choose one single chunk, so the HDF5 backend will
+     * return the whole dataset as one chunk.
      *
      * Let's just write some random chunks and show that the HDF5 backend
      * does not care.
@@ -2698,6 +2700,73 @@ TEST_CASE("available_chunks_test_hdf5", "[serial][json]")
          */
         REQUIRE(bool(table[0] == WrittenChunkInfo({0, 0}, {height, 4})));
     }
+
+    /*
+     * With explicit 2x2 storage chunks, only the allocated chunks are
+     * reported, merged along the dimensions:
+     *
+     *      0123
+     *    0 ____
+     *    1 ____
+     *    2 ****
+     *    3 ****
+     *    4 ****
+     *    5 ****
+     *    6 ____
+     *    7 ____
+     *    8 ___*
+     *    9 ___*
+     *
+     * Additionally, the edge chunks of a 5x3 dataset are clipped to its
+     * extent.
+     */
+    {
+        Series write(name, Access::CREATE);
+        Iteration it0 = write.iterations[0];
+        auto E_x = it0.meshes["E"]["x"];
+        E_x.resetDataset(
+            {Datatype::INT,
+             {height, 4},
+             R"({"hdf5": {"dataset": {"chunks": [2, 2]}}})"});
+        for (unsigned line = 2; line < 6; ++line)
+        {
+            E_x.storeChunk(data, {line, 0}, {1, 4});
+        }
+        E_x.storeChunk(data, {8, 3}, {2, 1});
+
+        auto E_y = it0.meshes["E"]["y"];
+        E_y.resetDataset(
+            {Datatype::INT,
+             {5, 3},
+             R"({"hdf5": {"dataset": {"chunks": [2, 2]}}})"});
+        std::vector<int> allData(15, 1);
+        E_y.storeChunk(allData, {0, 0}, {5, 3});
+
+        // no chunk allocated, reported as a whole (reads as fill value)
+        auto E_z = it0.meshes["E"]["z"];
+        E_z.resetDataset(
+            {Datatype::INT,
+             {5, 3},
+             R"({"hdf5": {"dataset": {"chunks": [2, 2]}}})"});
+        it0.close();
+    }
+
+    {
+        Series read(name, Access::READ_ONLY);
+        Iteration it0 = read.iterations[0];
+        ChunkTable table = it0.meshes["E"]["x"].availableChunks();
+        REQUIRE(table.size() == 2);
+        REQUIRE(bool(table[0] == WrittenChunkInfo({2, 0}, {4, 4})));
+        REQUIRE(bool(table[1] == WrittenChunkInfo({8, 2}, {2, 2})));
+
+        table = it0.meshes["E"]["y"].availableChunks();
+        REQUIRE(table.size() == 1);
+        REQUIRE(bool(table[0] == WrittenChunkInfo({0, 0}, {5, 3})));
+
+        table = it0.meshes["E"]["z"].availableChunks();
+        REQUIRE(table.size() == 1);
+        REQUIRE(bool(table[0] == WrittenChunkInfo({0, 0}, {5, 3})));
+    }
 }
 
 TEST_CASE("optional_paths_110_test", "[serial]")
@@ -3947,6 +4016,211 @@ TEST_CASE("hdf5_deletion_test", "[serial][hdf5]")
 {
     deletion_test("h5");
 }
+
+TEST_CASE("hdf5_coalesced_writes", "[serial][hdf5]")
+{
+    std::string const filename = "../samples/hdf5_coalesced_writes.h5";
+    constexpr size_t rows = 6, cols = 8;
+    auto value = [](size_t row, size_t col) {
+        return double(row * 100 + col);
+    };
+    {
+        Series write(filename, Access::CREATE);
+        auto it = write.iterations[0];
+        auto grid = it.meshes["grid"];
+        grid.resetDataset({Datatype::DOUBLE, {rows, cols}});
+        // 2x4 blocks, stored in reverse order so that their rows interleave
+        // in the file
+        for (size_t r = rows; r > 0; r -= 2)
+        {
+            for (size_t c = cols; c > 0; c -= 4)
+            {
+                std::shared_ptr<double> data{
+                    new double[8], [](double *p) { delete[] p; }};
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        data.get()[i * 4 + j] = value(r - 2 + i, c - 4 + j);
+                    }
+                }
+                grid.storeChunk(data, {r - 2, c - 4}, {2, 4});
+                // empty chunks join the run without writing anything
+                grid.storeChunk(data, {r - 2, c - 4}, {0, 4});
+            }
+        }
+
+        // overlapping chunks must be applied in order
+        auto overlap = it.meshes["overlap"];
+        overlap.resetDataset({Datatype::INT, {10}});
+        overlap.storeChunk(std::make_shared<int>(1), {3}, {1});
+        std::shared_ptr<int> ones{new int[10], [](int *p) { delete[] p; }};
+        std::fill_n(ones.get(), 10, 1);
+        overlap.storeChunk(ones, {0}, {10});
+        overlap.storeChunk(std::make_shared<int>(2), {5}, {1});
+
+        write.flush();
+    }
+    {
+        Series read(filename, Access::READ_ONLY);
+        auto it = read.iterations[0];
+        auto grid = it.meshes["grid"].loadChunk<double>();
+        auto overlap = it.meshes["overlap"].loadChunk<int>();
+        read.flush();
+        for (size_t r = 0; r < rows; ++r)
+        {
+            for (size_t c = 0; c < cols; ++c)
+            {
+                REQUIRE(grid.get()[r * cols + c] == value(r, c));
+            }
+        }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            REQUIRE(overlap.get()[i] == (i == 5 ? 2 : 1));
+        }
+    }
+}
+
+TEST_CASE("hdf5_dataset_handle_cache", "[serial][hdf5]")
+{
+    constexpr size_t numChunks = 10;
+    constexpr size_t chunkSize = 10;
+    for (size_t cacheSize : {0, 1, 16})
+    {
+        std::string const filename =
+            "../samples/hdf5_dataset_handle_cache_" +
+            std::to_string(cacheSize) + ".h5";
+        std::string const config =
+            R"({"hdf5": {"dataset_handle_cache_size": )" +
+            std::to_string(cacheSize) + "}}";
+        {
+            Series write(filename, Access::CREATE, config);
+            auto E = write.iterations[0].meshes["E"];
+            for (auto const &component : {"x", "y", "z"})
+            {
+                E[component].resetDataset(
+                    {Datatype::INT,
+                     {numChunks * chunkSize},
+                     R"({"resizable": true})"});
+            }
+            // interleave the components so the cache sees all of them
+            // in turn
+            for (size_t i = 0; i < numChunks; ++i)
+            {
+                for (auto const &component : {"x", "y", "z"})
+                {
+                    std::shared_ptr<int> data{
+                        new int[chunkSize], [](int *p) { delete[] p; }};
+                    std::iota(
+                        data.get(), data.get() + chunkSize, int(i * chunkSize));
+                    E[component].storeChunk(
+                        data, {i * chunkSize}, {chunkSize});
+                }
+                write.flush();
+            }
+
+            // a cached handle must not retain the dataspace prior to
+            // extending the dataset
+            if (auxiliary::getEnvString("OPENPMD_HDF5_CHUNKS", "auto") !=
+                "none")
+            {
+                E["x"].resetDataset(
+                    {Datatype::INT, {(numChunks + 1) * chunkSize}});
+                std::shared_ptr<int> data{
+                    new int[chunkSize], [](int *p) { delete[] p; }};
+                std::iota(
+                    data.get(),
+                    data.get() + chunkSize,
+                    int(numChunks * chunkSize));
+                E["x"].storeChunk(data, {numChunks * chunkSize}, {chunkSize});
+                write.flush();
+            }
+        }
+
+        {
+            Series read(filename, Access::READ_ONLY, config);
+            auto E = read.iterations[0].meshes["E"];
+            for (auto const &component : {"x", "y", "z"})
+            {
+                std::vector<std::shared_ptr<int>> chunks;
+                for (size_t i = 0; i < E[component].getExtent()[0] / chunkSize;
+                     ++i)
+                {
+                    chunks.push_back(E[component].loadChunk<int>(
+                        {i * chunkSize}, {chunkSize}));
+                }
+                read.flush();
+                for (size_t i = 0; i < chunks.size(); ++i)
+                {
+                    for (size_t j = 0; j < chunkSize; ++j)
+                    {
+                        REQUIRE(
+                            chunks[i].get()[j] == int(i * chunkSize + j));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("hdf5_mmap", "[serial][hdf5]")
+{
+    std::string const filename = "../samples/hdf5_mmap.h5";
+    {
+        Series write(filename, Access::CREATE);
+        auto E = write.iterations[0].meshes["E"];
+        std::vector<double> data(20);
+        std::iota(data.begin(), data.end(), 0.);
+        // contiguous storage, served from the mapping
+        E["x"].resetDataset(
+            {Datatype::DOUBLE,
+             {4, 5},
+             R"({"hdf5": {"dataset": {"chunks": "none"}}})"});
+        E["x"].storeChunk(data, {0, 0}, {4, 5});
+        // chunked storage, read via H5Dread
+        E["y"].resetDataset(
+            {Datatype::DOUBLE,
+             {4, 5},
+             R"({"hdf5": {"dataset": {"chunks": [2, 5]}}})"});
+        E["y"].storeChunk(data, {0, 0}, {4, 5});
+        write.flush();
+    }
+
+    Series read(filename, Access::READ_ONLY, R"({"hdf5": {"mmap": true}})");
+    auto E = read.iterations[0].meshes["E"];
+
+    // full rows are contiguous in the file, so they are available
+    // without a flush
+    auto rows = E["x"].loadChunkView<double>({1, 0}, {2, 5});
+    REQUIRE(rows.get()[0] == 5.);
+    REQUIRE(rows.get()[9] == 14.);
+    // both point into the same mapping rather than into separate copies
+    auto lastRow = E["x"].loadChunkView<double>({2, 0}, {1, 5});
+    REQUIRE(lastRow.get() == rows.get() + 5);
+    auto partialRow = E["x"].loadChunkView<double>({1, 2}, {1, 3});
+    REQUIRE(partialRow.get() == rows.get() + 2);
+    REQUIRE(partialRow.get()[0] == 7.);
+
+    // strided within the dataset or chunked storage: copies, filled upon
+    // flush
+    auto block = E["x"].loadChunkView<double>({1, 1}, {2, 3});
+    auto slice = E["x"].loadChunk<double>({0, 2}, {4, 2});
+    auto chunked = E["y"].loadChunkView<double>({1, 0}, {2, 5});
+    auto chunkedAgain = E["y"].loadChunkView<double>({1, 0}, {2, 5});
+    REQUIRE(block.get() != rows.get() + 1);
+    REQUIRE(chunked.get() != chunkedAgain.get());
+    read.flush();
+    REQUIRE(block.get()[0] == 6.);
+    REQUIRE(block.get()[5] == 13.);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(slice.get()[2 * i] == double(5 * i + 2));
+        REQUIRE(slice.get()[2 * i + 1] == double(5 * i + 3));
+    }
+    REQUIRE(chunked.get()[0] == 5.);
+    REQUIRE(chunked.get()[9] == 14.);
+    REQUIRE(chunkedAgain.get()[9] == 14.);
+}
 #else
 TEST_CASE("no_serial_hdf5", "[serial][hdf5]")
 {
@@ -7706,3 +7980,946 @@ TEST_CASE("joined_dim", "[serial]")
         }
     }
 }
+
+void async_flush(std::string const &ext)
+{
+    std::string filename = "../samples/async_flush/async_flush." + ext;
+    constexpr size_t length = 100;
+    constexpr size_t numIterations = 5;
+    {
+        Series write(filename, Access::CREATE, R"({"async": {"threads": 1}})");
+        for (size_t i = 0; i < numIterations; ++i)
+        {
+            auto iteration = write.iterations[i];
+            auto E_x = iteration.meshes["E"]["x"];
+            E_x.resetDataset({Datatype::DOUBLE, {length}});
+            // buffers handed to the background flush are owned by the task
+            auto data = std::shared_ptr<double>(
+                new double[length], [](double const *p) { delete[] p; });
+            std::iota(data.get(), data.get() + length, double(i * length));
+            E_x.storeChunk(std::move(data), {0}, {length});
+            iteration.setAttribute("step", i);
+            // returns while the data is still being written
+            iteration.close();
+        }
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    REQUIRE(read.iterations.size() == numIterations);
+    for (auto &[index, iteration] : read.iterations)
+    {
+        REQUIRE(iteration.getAttribute("step").get<size_t>() == index);
+        auto E_x = iteration.meshes["E"]["x"];
+        auto chunk = E_x.loadChunk<double>({0}, {length});
+        iteration.close();
+        for (size_t j = 0; j < length; ++j)
+        {
+            REQUIRE(chunk.get()[j] == double(index * length + j));
+        }
+    }
+}
+
+TEST_CASE("async_flush", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        async_flush(t);
+    }
+}
+
+void async_flush_extend(std::string const &ext)
+{
+    std::string filename = "../samples/async_flush_extend." + ext;
+    constexpr size_t length = 100000;
+    std::vector<double> data(2 * length);
+    std::iota(data.begin(), data.end(), 0.);
+    {
+        Series write(filename, Access::CREATE, R"({"async": {"threads": 1}})");
+        auto B = write.iterations[0].meshes["B"][RecordComponent::SCALAR];
+        B.resetDataset({Datatype::DOUBLE, {2 * length}});
+        B.storeChunk(data, {0}, {2 * length});
+        write.flush();
+        // written before E, so that E is created late in the background
+        B.storeChunk(data, {0}, {2 * length});
+        auto E = write.iterations[0].meshes["E"];
+        E["x"].resetDataset(
+            {Datatype::DOUBLE, {length}, R"({"resizable": true})"});
+        E["x"].storeChunk(data, {0}, {length});
+        E["y"].resetDataset({Datatype::DOUBLE, {length}});
+        E["y"].storeChunk(data, {0}, {length});
+        // datasets are still being created in the background
+        write.flush();
+        // must be treated as an extension of the existing dataset
+        E["x"].resetDataset({Datatype::DOUBLE, {2 * length}});
+        E["x"].storeChunkRaw(data.data() + length, {length}, {length});
+        write.flush();
+        // must be rejected as a redefinition of the existing dataset
+        REQUIRE_THROWS_AS(
+            E["y"].resetDataset({Datatype::INT, {length}}),
+            std::runtime_error);
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    auto E_x = read.iterations[0].meshes["E"]["x"];
+    REQUIRE(E_x.getExtent() == Extent{2 * length});
+    REQUIRE(
+        read.iterations[0].meshes["E"]["y"].getDatatype() ==
+        Datatype::DOUBLE);
+    auto chunk = E_x.loadChunk<double>();
+    read.flush();
+    REQUIRE(std::equal(data.begin(), data.end(), chunk.get()));
+}
+
+TEST_CASE("async_flush_extend", "[serial]")
+{
+    async_flush_extend("json");
+#if openPMD_HAVE_ADIOS2
+    async_flush_extend("bp");
+#endif
+#if openPMD_HAVE_HDF5
+    // extensible datasets require chunking
+    if (auxiliary::getEnvString("OPENPMD_HDF5_CHUNKS", "auto") != "none")
+    {
+        async_flush_extend("h5");
+    }
+#endif
+}
+
+void metadata_index(std::string const &ext)
+{
+    std::string const directory = "../samples/metadata_index_" + ext;
+    std::string const filename = directory + "/data_%T." + ext;
+    std::string const indexFile = filename + ".index.json";
+    if (auxiliary::directory_exists(directory))
+    {
+        auxiliary::remove_directory(directory);
+    }
+
+    auto writeIterations = [&filename](
+                               Access access,
+                               std::string const &options,
+                               std::vector<int> const &indexes) {
+        Series write(filename, access, options);
+        for (int i : indexes)
+        {
+            auto E_x = write.iterations[i].meshes["E"]["x"];
+            E_x.resetDataset({Datatype::INT, {1}});
+            E_x.makeConstant(i);
+        }
+    };
+    auto iterationsOf = [&filename](std::string const &options) {
+        Series read(filename, Access::READ_ONLY, options);
+        std::vector<Series::IterationIndex_t> res;
+        for (auto &[index, iteration] : read.iterations)
+        {
+            res.push_back(index);
+        }
+        return res;
+    };
+    using indexes_t = std::vector<Series::IterationIndex_t>;
+    std::string const useIndex = R"({"metadata_index": true})";
+    auto valueOf = [&filename](bool withIndex, int iteration) {
+        Series read(
+            filename,
+            Access::READ_ONLY,
+            withIndex
+                ? R"({"defer_iteration_parsing": true, "metadata_index": true})"
+                : R"({"defer_iteration_parsing": true})");
+        auto E_x = read.iterations[iteration].open().meshes["E"]["x"];
+        auto chunk = E_x.loadChunk<int>();
+        read.flush();
+        return *chunk;
+    };
+    auto modifyIndex = [&indexFile](auto &&modify) {
+        std::string content;
+        {
+            std::ifstream in(indexFile);
+            std::getline(in, content);
+        }
+        modify(content);
+        // rewriting the index in place keeps the names in the directory
+        std::ofstream out(indexFile, std::ios_base::trunc);
+        out << content << '\n';
+    };
+
+    writeIterations(Access::CREATE, useIndex, {10, 20, 30});
+    REQUIRE(auxiliary::file_exists(indexFile));
+    REQUIRE(iterationsOf("{}") == indexes_t{10, 20, 30});
+
+    // The index is only used with the option, as long as the names in the
+    // directory are unchanged.
+    modifyIndex([](std::string &content) {
+        // drop the entry of iteration 20
+        auto begin = content.find("\"20\":{");
+        REQUIRE(begin != std::string::npos);
+        auto end = content.find("},", begin);
+        REQUIRE(end != std::string::npos);
+        content.erase(begin, end + 2 - begin);
+    });
+    REQUIRE(iterationsOf("{}") == indexes_t{10, 20, 30});
+    // This reader records the hierarchy of the parsed iterations
+    // and rewrites the index upon closing, scanning the directory.
+    REQUIRE(iterationsOf(useIndex) == indexes_t{10, 30});
+    REQUIRE(iterationsOf(useIndex) == indexes_t{10, 20, 30});
+
+    // Attributes are served from the cached hierarchy, as long as the file
+    // is unchanged.
+    modifyIndex([](std::string &content) {
+        std::string const cached = R"({"datatype":"INT","value":30})";
+        auto pos = content.find(cached);
+        REQUIRE(pos != std::string::npos);
+        content.replace(pos, cached.size(), R"({"datatype":"INT","value":31})");
+    });
+    REQUIRE(valueOf(false, 30) == 30);
+    REQUIRE(valueOf(true, 30) == 31);
+    REQUIRE(valueOf(true, 20) == 20);
+    {
+        std::ofstream append(
+            directory + "/data_30." + ext, std::ios_base::app);
+        append << '\n';
+    }
+    REQUIRE(valueOf(true, 30) == 30);
+
+    // Adding a file outdates the index, readers fall back to scanning
+    writeIterations(Access::APPEND, "{}", {40});
+    REQUIRE(iterationsOf(useIndex) == indexes_t{10, 20, 30, 40});
+    REQUIRE(iterationsOf(useIndex) == indexes_t{10, 20, 30, 40});
+    REQUIRE(valueOf(true, 40) == 40);
+}
+
+TEST_CASE("metadata_index", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        metadata_index(t);
+    }
+}
+
+void parallel_iteration_parsing(std::string const &ext)
+{
+    std::string const filename =
+        "../samples/parallel_iteration_parsing/data_%05T." + ext;
+    constexpr int numIterations = 10;
+    {
+        Series write(filename, Access::CREATE);
+        for (int i = 0; i < numIterations; ++i)
+        {
+            auto E_x = write.iterations[i].meshes["E"]["x"];
+            E_x.resetDataset({Datatype::INT, {3}});
+            auto data = std::shared_ptr<int>(
+                new int[3]{i, 2 * i, 3 * i}, [](int const *p) { delete[] p; });
+            E_x.storeChunk(std::move(data), {0}, {3});
+            write.iterations[i].setAttribute("step", i);
+        }
+    }
+
+    // more threads than iterations per batch and an incomplete last batch
+    for (unsigned threads : {2, 4, 32})
+    {
+        Series read(
+            filename,
+            Access::READ_ONLY,
+            R"({"iteration_parsing": {"threads": )" +
+                std::to_string(threads) + "}}");
+        REQUIRE(read.iterations.size() == numIterations);
+        for (auto &[index, iteration] : read.iterations)
+        {
+            REQUIRE(iteration.getAttribute("step").get<int>() == int(index));
+            auto chunk = iteration.meshes["E"]["x"].loadChunk<int>();
+            iteration.close();
+            REQUIRE(chunk.get()[2] == 3 * int(index));
+        }
+    }
+}
+
+TEST_CASE("parallel_iteration_parsing", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        parallel_iteration_parsing(t);
+    }
+}
+
+TEST_CASE("json_dataset_modes", "[serial][json]")
+{
+    for (std::string const ext : {"json", "toml"})
+    {
+        for (std::string const mode : {"base64", "binary"})
+        {
+            std::string const filename =
+                "../samples/json_dataset_mode_" + mode + "." + ext;
+            std::string const config =
+                R"({")" + ext + R"(": {"dataset": {"mode": ")" + mode +
+                R"("}}})";
+            {
+                Series write(filename, Access::CREATE, config);
+                auto mesh = write.iterations[0].meshes;
+                auto E_x = mesh["E"]["x"];
+                E_x.resetDataset({Datatype::DOUBLE, {4, 5}});
+                std::vector<double> data(30);
+                std::iota(data.begin(), data.end(), 0.);
+                // two partial chunks, the remainder stays zero
+                E_x.storeChunkRaw(data.data(), {0, 0}, {2, 5});
+                E_x.storeChunkRaw(data.data() + 12, {2, 2}, {2, 3});
+                write.flush();
+                E_x.resetDataset(Dataset({6, 5}));
+                E_x.storeChunkRaw(data.data() + 20, {4, 0}, {2, 5});
+
+                auto c = mesh["c"][RecordComponent::SCALAR];
+                c.resetDataset({Datatype::CDOUBLE, {3}});
+                std::vector<std::complex<double>> complexData{
+                    {1., -1.}, {2., -2.}, {3., -3.}};
+                c.storeChunkRaw(complexData.data(), {0}, {3});
+
+                // per-dataset override of the global mode
+                auto E_y = mesh["E"]["y"];
+                std::string const datasetConfig =
+                    R"({")" + ext + R"(": {"dataset": {"mode": "dataset"}}})";
+                E_y.resetDataset({Datatype::INT, {3}, datasetConfig});
+                std::vector<int> intData{1, 2, 3};
+                E_y.storeChunkRaw(intData.data(), {0}, {3});
+                write.flush();
+            }
+            REQUIRE(
+                auxiliary::file_exists(filename + ".bin") ==
+                (mode == "binary"));
+
+            Series read(filename, Access::READ_ONLY);
+            auto mesh = read.iterations[0].meshes;
+            auto E_x = mesh["E"]["x"];
+            REQUIRE(E_x.getExtent() == Extent{6, 5});
+            auto all = E_x.loadChunk<double>();
+            auto slab = E_x.loadChunk<double>({2, 1}, {3, 3});
+            auto complexData = mesh["c"][RecordComponent::SCALAR]
+                                   .loadChunk<std::complex<double>>();
+            auto intData = mesh["E"]["y"].loadChunk<int>();
+            read.flush();
+            for (size_t i = 0; i < 30; ++i)
+            {
+                size_t row = i / 5, col = i % 5;
+                double expected = row < 2 || row >= 4 ? double(i)
+                    : col >= 2 ? double(12 + (row - 2) * 3 + col - 2)
+                               : 0.;
+                REQUIRE(all.get()[i] == expected);
+            }
+            for (size_t i = 0; i < 9; ++i)
+            {
+                size_t row = 2 + i / 3, col = 1 + i % 3;
+                REQUIRE(slab.get()[i] == all.get()[row * 5 + col]);
+            }
+            REQUIRE(complexData.get()[2] == std::complex<double>(3., -3.));
+            REQUIRE(intData.get()[2] == 3);
+        }
+    }
+}
+
+TEST_CASE("json_journal", "[serial][json]")
+{
+    for (std::string const ext : {"json", "toml"})
+    {
+        for (std::string const mode : {"dataset", "base64", "binary"})
+        {
+            std::string const filename =
+                "../samples/json_journal_" + mode + "." + ext;
+            std::string const config = R"({")" + ext +
+                R"(": {"journal": true, "dataset": {"mode": ")" + mode +
+                R"("}}})";
+            auto check = [&filename](size_t numberOfIterations) {
+                Series read(filename, Access::READ_ONLY);
+                REQUIRE(read.iterations.size() == numberOfIterations);
+                for (auto &[index, iteration] : read.iterations)
+                {
+                    auto data = iteration.meshes["E"]["x"].loadChunk<double>();
+                    read.flush();
+                    for (size_t i = 0; i < 6; ++i)
+                    {
+                        double expected = index == 0 && i < 3
+                            ? iteration.getAttribute("first_row")
+                                  .get<std::vector<double>>()
+                                  .at(i)
+                            : double(index * 10 + i);
+                        REQUIRE(data.get()[i] == expected);
+                    }
+                }
+            };
+            {
+                Series write(filename, Access::CREATE, config);
+                std::vector<double> data(6);
+                auxiliary::FileStatus initialStatus{};
+                for (Series::IterationIndex_t index = 0; index < 4; ++index)
+                {
+                    auto E_x = write.iterations[index].meshes["E"]["x"];
+                    E_x.resetDataset({Datatype::DOUBLE, {2, 3}});
+                    std::iota(data.begin(), data.end(), double(index * 10));
+                    E_x.storeChunkRaw(data.data(), {0, 0}, {2, 3});
+                    write.iterations[0].setAttribute(
+                        "first_row", std::vector<double>{0., 1., 2.});
+                    write.flush();
+                    // only the first flush writes the whole file,
+                    // the later ones append to the journal
+                    REQUIRE(
+                        auxiliary::file_exists(filename + ".journal") ==
+                        (index > 0));
+                    auto status = auxiliary::file_status(filename);
+                    REQUIRE(status.has_value());
+                    if (index == 0)
+                    {
+                        initialStatus = *status;
+                    }
+                    REQUIRE(status->size == initialStatus.size);
+                    check(index + 1);
+                }
+
+                // modify a dataset and an attribute from an earlier flush
+                std::vector<double> firstRow{-1., -2., -3.};
+                write.iterations[0].meshes["E"]["x"].storeChunkRaw(
+                    firstRow.data(), {0, 0}, {1, 3});
+                write.iterations[0].setAttribute("first_row", firstRow);
+                auto sidecarSize = [&filename]() {
+                    auto status = auxiliary::file_status(filename + ".bin");
+                    return status.has_value() ? status->size : 0;
+                };
+                auto sidecarBefore = sidecarSize();
+                write.flush();
+                check(4);
+
+                // only the written row is journaled, not the whole dataset
+                std::ifstream journal(filename + ".journal");
+                std::string line, lastLine;
+                while (std::getline(journal, line))
+                {
+                    lastLine = line;
+                }
+                REQUIRE(
+                    lastLine.find(R"("op":"hyperslab")") != std::string::npos);
+                REQUIRE(
+                    lastLine.find(R"("extent":[1,3])") != std::string::npos);
+                REQUIRE(
+                    sidecarSize() - sidecarBefore ==
+                    (mode == "binary" ? 3 * sizeof(double) : 0));
+            }
+            // the journal is compacted into the file upon closing
+            REQUIRE(!auxiliary::file_exists(filename + ".journal"));
+            check(4);
+        }
+    }
+}
+
+TEST_CASE("read_filter", "[serial]")
+{
+    std::string const filename = "../samples/read_filter.json";
+    {
+        Series write(filename, Access::CREATE);
+        auto iteration = write.iterations[0];
+        for (auto const &mesh : {"E", "B"})
+        {
+            iteration.meshes[mesh][RecordComponent::SCALAR].makeConstant(1.);
+            iteration.meshes[mesh][RecordComponent::SCALAR].resetDataset(
+                {Datatype::DOUBLE, {10}});
+        }
+        for (auto const &species : {"e", "i"})
+        {
+            for (auto const &record : {"position", "momentum"})
+            {
+                auto rc = iteration.particles[species][record]["x"];
+                rc.resetDataset({Datatype::DOUBLE, {10}});
+                rc.makeConstant(2.);
+            }
+        }
+        write.flush();
+    }
+
+    {
+        Series read(
+            filename,
+            Access::READ_ONLY,
+            R"({"read_filter": ["meshes/E", "/particles/e/position/"]})");
+        auto iteration = read.iterations[0];
+        REQUIRE(iteration.meshes.size() == 1);
+        REQUIRE(iteration.meshes.contains("E"));
+        REQUIRE(iteration.particles.size() == 1);
+        REQUIRE(iteration.particles["e"].size() == 1);
+        REQUIRE(iteration.particles["e"].contains("position"));
+    }
+
+    {
+        Series read(
+            filename, Access::READ_ONLY, R"({"read_filter": ["particles"]})");
+        auto iteration = read.iterations[0];
+        REQUIRE(iteration.meshes.empty());
+        REQUIRE(iteration.particles.size() == 2);
+        REQUIRE(iteration.particles["i"].size() == 2);
+    }
+
+    REQUIRE_THROWS_AS(
+        Series(filename, Access::READ_ONLY, R"({"read_filter": "meshes"})"),
+        error::BackendConfigSchema);
+    REQUIRE_THROWS_AS(
+        Series(
+            filename, Access::READ_ONLY, R"({"read_filter": ["mesh/E"]})"),
+        error::BackendConfigSchema);
+}
+
+TEST_CASE("buffer_pool_load_chunk", "[serial]")
+{
+    std::string const filename = "../samples/buffer_pool.json";
+    {
+        Series write(filename, Access::CREATE);
+        auto E_x = write.iterations[0].meshes["E"]["x"];
+        E_x.resetDataset({Datatype::FLOAT, {10}});
+        // buffer allocated by the openPMD API
+        auto span = E_x.storeChunk<float>({0}, {10});
+        std::iota(span.currentBuffer().begin(), span.currentBuffer().end(), 0);
+        write.flush();
+    }
+
+    Series read(
+        filename, Access::READ_ONLY, R"({"buffer_pool": {"max_bytes": 4096}})");
+    auto E_x = read.iterations[0].meshes["E"]["x"];
+    for (size_t i = 0; i < 3; ++i)
+    {
+        auto data = E_x.loadChunk<float>({2}, {5});
+        read.flush();
+        REQUIRE(data.get()[4] == 6.f);
+    }
+    auto statistics = read.bufferPoolStatistics();
+    REQUIRE(statistics.allocations == 1);
+    REQUIRE(statistics.reuses == 2);
+    REQUIRE(statistics.releases == 3);
+}
+
+inline void load_chunk_view(std::string const &ext)
+{
+    std::string const filename = "../samples/load_chunk_view." + ext;
+    {
+        Series write(filename, Access::CREATE);
+        auto it = write.iterations[0];
+        auto E_x = it.meshes["E"]["x"];
+        E_x.resetDataset({Datatype::INT, {2, 5}});
+        std::vector<int> data(10);
+        std::iota(data.begin(), data.end(), 0);
+        E_x.storeChunk(data, {0, 0}, {2, 5});
+        auto rho = it.meshes["rho"][RecordComponent::SCALAR];
+        rho.resetDataset({Datatype::INT, {3}});
+        rho.makeConstant(7);
+        write.flush();
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    auto it = read.iterations[0];
+    auto E_x = it.meshes["E"]["x"];
+    auto full = E_x.loadChunkView<int>();
+    auto slice = E_x.loadChunkView<int>({1, 1}, {1, 3});
+    auto constant =
+        it.meshes["rho"][RecordComponent::SCALAR].loadChunkView<int>();
+    read.flush();
+    for (int i = 0; i < 10; ++i)
+    {
+        REQUIRE(full.get()[i] == i);
+    }
+    REQUIRE(slice.get()[0] == 6);
+    REQUIRE(slice.get()[2] == 8);
+    REQUIRE(constant.get()[2] == 7);
+}
+
+inline void record_component_statistics(std::string const &ext)
+{
+    std::string const filename =
+        "../samples/record_component_statistics." + ext;
+    {
+        Series write(
+            filename,
+            Access::CREATE,
+            R"({"statistics": {"histogram_bins": 4}})");
+        auto it = write.iterations[0];
+        auto E_x = it.meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {10}});
+        std::vector<double> field{
+            4., 1., std::numeric_limits<double>::quiet_NaN(), -2., 3.};
+        std::vector<double> constantField(5, 0.5);
+        E_x.storeChunk(field, {0}, {5});
+        E_x.storeChunk(constantField, {5}, {5});
+
+        // written in two flushes
+        auto id = it.particles["e"]["id"][RecordComponent::SCALAR];
+        id.resetDataset({Datatype::INT, {20}});
+        std::vector<int> ids(20);
+        std::iota(ids.begin(), ids.end(), 0);
+        id.storeChunkRaw(ids.data(), {0}, {10});
+        write.flush();
+        id.storeChunkRaw(ids.data() + 10, {10}, {10});
+
+        auto rho = it.meshes["rho"][RecordComponent::SCALAR];
+        rho.resetDataset({Datatype::FLOAT, {3}});
+        rho.makeConstant(1.f);
+
+        REQUIRE(!E_x.statistics().has_value());
+        it.close();
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    auto it = read.iterations[0];
+
+    auto E_x = it.meshes["E"]["x"].statistics();
+    REQUIRE(E_x.has_value());
+    REQUIRE(E_x->min == -2.);
+    REQUIRE(E_x->max == 4.);
+    REQUIRE(E_x->count == 9);
+    REQUIRE(E_x->mean == Approx(8.5 / 9));
+    // bins of width 1.5 starting at -2
+    REQUIRE(E_x->histogram == std::vector<uint64_t>{1, 5, 1, 2});
+
+    auto id =
+        it.particles["e"]["id"][RecordComponent::SCALAR].statistics();
+    REQUIRE(id.has_value());
+    REQUIRE(id->min == 0.);
+    REQUIRE(id->max == 19.);
+    REQUIRE(id->mean == 9.5);
+    REQUIRE(id->count == 20);
+    REQUIRE(
+        std::accumulate(id->histogram.begin(), id->histogram.end(), 0u) ==
+        20);
+
+    // value bounds of the chunks are within [0, 19]
+    auto idComponent = it.particles["e"]["id"][RecordComponent::SCALAR];
+    auto allChunks = idComponent.availableChunks();
+    REQUIRE(!allChunks.empty());
+    REQUIRE(idComponent
+                .availableChunks([](double, double max) { return max > 19.; })
+                .empty());
+    REQUIRE(
+        idComponent
+            .availableChunks([](double min, double) { return min <= 5.; })
+            .size() >= 1);
+    REQUIRE(
+        idComponent.availableChunks([](double, double) { return true; }) ==
+        allChunks);
+
+    REQUIRE(
+        !it.meshes["rho"][RecordComponent::SCALAR].statistics().has_value());
+}
+
+TEST_CASE("record_component_statistics", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        record_component_statistics(t);
+    }
+}
+
+inline void read_iterations_prefetch(std::string const &ext)
+{
+    std::string const filename =
+        "../samples/read_iterations_prefetch_%T." + ext;
+    {
+        Series write(filename, Access::CREATE);
+        for (uint64_t i = 0; i < 5; ++i)
+        {
+            auto it = write.writeIterations()[i];
+            auto E_x = it.meshes["E"]["x"];
+            E_x.resetDataset({determineDatatype<uint64_t>(), {1}});
+            E_x.storeChunkRaw(&i, {0}, {1});
+            it.close();
+        }
+    }
+
+    for (auto const &options :
+         {R"({"prefetch": 2})", "prefetch = 2\nprefetch_max_bytes = 1024"})
+    {
+        for (auto access : {Access::READ_LINEAR, Access::READ_ONLY})
+        {
+            Series read(filename, access);
+            uint64_t expected = 0;
+            for (auto iteration : read.readIterations(options))
+            {
+                REQUIRE(iteration.iterationIndex == expected);
+                auto E_x = iteration.meshes["E"]["x"].loadChunk<uint64_t>();
+                iteration.close();
+                REQUIRE(*E_x == expected);
+                ++expected;
+            }
+            REQUIRE(expected == 5);
+        }
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    REQUIRE_THROWS_AS(
+        read.readIterations(R"({"prefetch": "all"})"),
+        error::BackendConfigSchema);
+}
+
+TEST_CASE("read_iterations_prefetch", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        read_iterations_prefetch(t);
+    }
+}
+
+inline void prepared_flush_config(std::string const &ext)
+{
+    Series write(
+        "../samples/prepared_flush_config." + ext, Access::CREATE);
+    REQUIRE_THROWS(write.prepareFlushConfig("{ not json"));
+    auto config = write.prepareFlushConfig(R"({"unused_key": true})");
+
+    std::stringstream captured;
+    auto oldBuffer = std::cerr.rdbuf(captured.rdbuf());
+    auto E_x = write.iterations[0].meshes["E"]["x"];
+    E_x.resetDataset({Datatype::INT, {3}});
+    for (int i = 0; i < 3; ++i)
+    {
+        E_x.storeChunkRaw(&i, {static_cast<uint64_t>(i)}, {1});
+        write.flush(config);
+    }
+    std::cerr.rdbuf(oldBuffer);
+
+    // unused keys are reported upon the first flush only
+    auto output = captured.str();
+    auto firstWarning = output.find("unused_key");
+    REQUIRE(firstWarning != std::string::npos);
+    REQUIRE(output.find("unused_key", firstWarning + 1) == std::string::npos);
+}
+
+TEST_CASE("prepared_flush_config", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        prepared_flush_config(t);
+    }
+}
+
+inline void flush_closed_iterations(
+    std::string const &filename, std::string const &filenameGaps)
+{
+    auto writeIteration = [](Series &series, uint64_t i) {
+        auto it = series.iterations[i];
+        auto E_x = it.meshes["E"]["x"];
+        E_x.resetDataset({determineDatatype<uint64_t>(), {1}});
+        E_x.storeChunkRaw(&i, {0}, {1});
+        it.close();
+        series.flush();
+    };
+    {
+        Series write(filenameGaps, Access::CREATE);
+        for (uint64_t i = 0; i < 40; i += 2)
+        {
+            writeIteration(write, i);
+        }
+#if openPMD_USE_INVASIVE_TESTS
+        REQUIRE(write.get().m_finishedUpTo.has_value());
+#endif
+        // new iterations among the finished ones are flushed as well
+        writeIteration(write, 5);
+        writeIteration(write, 41);
+        writeIteration(write, 7);
+    }
+    {
+        Series read(filenameGaps, Access::READ_ONLY);
+        REQUIRE(read.iterations.size() == 23);
+        for (uint64_t i : {5, 7, 41})
+        {
+            auto E_x =
+                read.iterations[i].meshes["E"]["x"].loadChunk<uint64_t>();
+            read.flush();
+            REQUIRE(*E_x == i);
+        }
+    }
+
+    Series write(filename, Access::CREATE);
+    for (uint64_t i = 0; i < 20; ++i)
+    {
+        writeIteration(write, i);
+    }
+    // closed iterations are skipped, unless modified illegally
+    write.iterations[3].setAttribute("late", 1);
+    REQUIRE_THROWS_AS(write.flush(), std::runtime_error);
+}
+
+TEST_CASE("flush_closed_iterations", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        flush_closed_iterations(
+            "../samples/flush_closed_iterations_%T." + t,
+            "../samples/flush_closed_iterations_gaps_%T." + t);
+        flush_closed_iterations(
+            "../samples/flush_closed_iterations." + t,
+            "../samples/flush_closed_iterations_gaps." + t);
+    }
+}
+
+inline void evict_closed_iterations(std::string const &filename)
+{
+    {
+        Series write(
+            filename, Access::CREATE, R"({"evict_closed_iterations": true})");
+        for (uint64_t i = 0; i < 5; ++i)
+        {
+            auto it = write.iterations[i];
+            it.setTime(static_cast<double>(i));
+            auto E_x = it.meshes["E"]["x"];
+            E_x.resetDataset({determineDatatype<uint64_t>(), {1}});
+            E_x.storeChunkRaw(&i, {0}, {1});
+            it.particles["e"]["id"][RecordComponent::SCALAR].makeConstant(i);
+            it.close();
+        }
+        // evicted upon the following flushes, only stubs remain
+        REQUIRE(write.iterations.size() == 5);
+        REQUIRE(write.iterations[0].meshes.empty());
+        REQUIRE(write.iterations[0].particles.empty());
+        REQUIRE(write.iterations[0].closed());
+        REQUIRE(write.iterations[0].time<double>() == 0.);
+        REQUIRE(write.iterations[3].meshes.empty());
+        // the most recently closed iteration has not been evicted yet
+        REQUIRE(write.iterations[4].meshes.contains("E"));
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    REQUIRE(read.iterations.size() == 5);
+    for (auto &[index, iteration] : read.iterations)
+    {
+        auto E_x = iteration.meshes["E"]["x"].loadChunk<uint64_t>();
+        iteration.close();
+        REQUIRE(*E_x == index);
+    }
+}
+
+TEST_CASE("evict_closed_iterations", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        evict_closed_iterations("../samples/evict_closed_iterations_%T." + t);
+        evict_closed_iterations("../samples/evict_closed_iterations." + t);
+    }
+}
+
+TEST_CASE("load_chunk_view", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        load_chunk_view(t);
+    }
+}
+
+inline void typed_record_component(std::string const &ext)
+{
+    std::string const filename = "../samples/typed_record_component." + ext;
+    {
+        Series write(filename, Access::CREATE);
+        auto E_x = write.iterations[0].meshes["E"]["x"];
+        REQUIRE_THROWS_AS(E_x.typed<double>(), error::WrongAPIUsage);
+        E_x.resetDataset({Datatype::DOUBLE, {4, 10}});
+        REQUIRE_THROWS_AS(E_x.typed<float>(), std::runtime_error);
+
+        auto typed = E_x.typed<double>();
+        std::vector<double> data(40);
+        std::iota(data.begin(), data.end(), 0.);
+        for (unsigned row = 0; row < 4; ++row)
+        {
+            typed.storeChunkRaw(data.data() + 10 * row, {row, 0}, {1, 10});
+        }
+        REQUIRE_THROWS_AS(
+            typed.storeChunkRaw(data.data(), {4, 0}, {1, 10}),
+            std::runtime_error);
+        REQUIRE_THROWS_AS(
+            typed.storeChunkRaw(data.data(), {0}, {10}), std::runtime_error);
+
+        auto rho = write.iterations[0].meshes["rho"][RecordComponent::SCALAR];
+        rho.resetDataset({Datatype::DOUBLE, {10}});
+        rho.makeConstant(1.);
+        REQUIRE_THROWS_AS(rho.typed<double>(), std::runtime_error);
+        write.flush();
+    }
+
+    Series read(filename, Access::READ_ONLY);
+    auto E_x = read.iterations[0].meshes["E"]["x"];
+    auto typed = E_x.typed<double>();
+    auto column = std::shared_ptr<double>{new double[4], [](double *p) {
+                                              delete[] p;
+                                          }};
+    auto row = std::shared_ptr<double>{new double[10], [](double *p) {
+                                           delete[] p;
+                                       }};
+    typed.loadChunk(column, {0, 3}, {4, 1});
+    typed.loadChunk(row, {2, 0}, {1, 10});
+    read.flush();
+    for (size_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(column.get()[i] == 10. * i + 3.);
+    }
+    for (size_t i = 0; i < 10; ++i)
+    {
+        REQUIRE(row.get()[i] == 20. + i);
+    }
+}
+
+TEST_CASE("typed_record_component", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        typed_record_component(t);
+    }
+}
+
+TEST_CASE("json_lazy_datasets", "[serial][json]")
+{
+    std::string const filename = "../samples/json_lazy_datasets.json";
+    {
+        Series write(filename, Access::CREATE);
+        auto mesh = write.iterations[0].meshes;
+        auto E_x = mesh["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {3, 2, 4}});
+        std::vector<double> data(24);
+        std::iota(data.begin(), data.end(), 0.5);
+        // leave the last slice unwritten
+        E_x.storeChunkRaw(data.data(), {0, 0, 0}, {2, 2, 4});
+
+        auto c = mesh["c"][RecordComponent::SCALAR];
+        c.resetDataset({Datatype::CFLOAT, {2}});
+        std::vector<std::complex<float>> complexData{{1.f, 2.f}, {3.f, 4.f}};
+        c.storeChunkRaw(complexData.data(), {0}, {2});
+
+        auto empty = mesh["empty"][RecordComponent::SCALAR];
+        empty.resetDataset({Datatype::INT, {0}});
+        write.flush();
+    }
+
+    Series eager(filename, Access::READ_ONLY);
+    Series lazy(
+        filename, Access::READ_ONLY, R"({"json": {"lazy_datasets": true}})");
+    auto eagerMesh = eager.iterations[0].meshes;
+    auto lazyMesh = lazy.iterations[0].meshes;
+    for (auto const &[name, component] :
+         std::vector<std::pair<std::string, std::string>>{
+             {"E", "x"},
+             {"c", RecordComponent::SCALAR},
+             {"empty", RecordComponent::SCALAR}})
+    {
+        auto eagerComponent = eagerMesh[name][component];
+        auto lazyComponent = lazyMesh[name][component];
+        REQUIRE(eagerComponent.getExtent() == lazyComponent.getExtent());
+        REQUIRE(
+            eagerComponent.availableChunks() ==
+            lazyComponent.availableChunks());
+    }
+
+    auto E_x = lazyMesh["E"]["x"];
+    auto slab = E_x.loadChunk<double>({1, 1, 1}, {1, 1, 3});
+    auto complexData = lazyMesh["c"][RecordComponent::SCALAR]
+                           .loadChunk<std::complex<float>>();
+    lazy.flush();
+    for (size_t i = 0; i < 3; ++i)
+    {
+        REQUIRE(slab.get()[i] == 8 + 4 + 1 + i + 0.5);
+    }
+    REQUIRE(complexData.get()[1] == std::complex<float>(3.f, 4.f));
+
+    // further loads are served by the dataset parsed before
+    auto row = E_x.loadChunk<double>({0, 1, 0}, {1, 1, 4});
+    lazy.flush();
+    for (size_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(row.get()[i] == 4 + i + 0.5);
+    }
+}